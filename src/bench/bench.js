@@ -0,0 +1,121 @@
+// benchmark scenarios for `--bench`: each one runs on a fresh engine with bench.bitsy loaded
+// (skipping the title), then `frame` is called before every frame and returns the buttons to
+// hold, using the same names as input scripts ("up", "down", "left", "right", "ok", "menu")
+var __bitsybox_bench_scenarios__ = [];
+
+function addBenchScenario(name, frameCount, isEngineUpdated, setup, frame) {
+	__bitsybox_bench_scenarios__.push({
+		name: name,
+		frameCount: frameCount,
+		isEngineUpdated: isEngineUpdated,
+		setup: setup,
+		frame: frame,
+	});
+}
+
+function __bitsybox_bench_setup__(index) {
+	load_game(bitsy.getGameData(), bitsy.getFontData(), false);
+	__bitsybox_bench_scenarios__[index].setup();
+}
+
+function __bitsybox_bench_frame__(index, frameIndex) {
+	var buttons = __bitsybox_bench_scenarios__[index].frame(frameIndex);
+	return buttons ? buttons : "";
+}
+
+function noBenchSetup() {
+}
+
+function noBenchInput(frameIndex) {
+	return "";
+}
+
+// redraws every tile of the room each frame (without running the rest of the engine)
+addBenchScenario("room redraw", 600, false, noBenchSetup, function(frameIndex) {
+	drawRoom(room[state.room], { redrawAll: true, frameIndex: frameIndex % 2 });
+});
+
+// walks the avatar back and forth along the open row of the room
+addBenchScenario("avatar walk", 600, true, noBenchSetup, function(frameIndex) {
+	return (Math.floor(frameIndex / 120) % 2) === 0 ? "right" : "left";
+});
+
+// goes back and forth between the two rooms using one transition effect
+function addTransitionScenario(effectName) {
+	addBenchScenario("transition " + effectName, 300, true, noBenchSetup, function(frameIndex) {
+		if (transition.IsTransitionActive()) {
+			return;
+		}
+
+		var endRoom = state.room === "0" ? "1" : "0";
+		transition.BeginTransition(state.room, player().x, player().y, endRoom, player().x, player().y, effectName);
+		transition.UpdateTransition(0);
+		transition.OnTransitionComplete(function() {
+			state.room = endRoom;
+			initRoom(state.room);
+		});
+	});
+}
+
+var benchTransitionEffects = ["fade_w", "fade_b", "wave", "tunnel", "slide_u", "slide_d", "slide_l", "slide_r"];
+for (var i = 0; i < benchTransitionEffects.length; i++) {
+	addTransitionScenario(benchTransitionEffects[i]);
+}
+
+// types out a page of text effects, closes it, then starts over
+var benchDialog = "{wvy}wavy words{wvy} and {shk}shaky words{shk} and {rbw}rainbow words{rbw} all at once";
+
+addBenchScenario("dialog effects", 600, true, function() {
+	startDialog(benchDialog);
+}, function(frameIndex) {
+	if (!dialogBuffer.IsActive()) {
+		startDialog(benchDialog);
+	}
+
+	// one frame presses, so the engine sees a new press each time
+	return (frameIndex % 120) === 119 ? "ok" : "";
+});
+
+// the bench game with a couple hundred more rooms, tiles, sprites and dialogs
+var benchLargeGameData = null;
+
+function createLargeGameData() {
+	var gameData = bitsy.getGameData();
+	var roomRow = "a,b,c,0,a,b,c,0,a,b,c,0,a,b,c,0\n";
+
+	for (var i = 0; i < 200; i++) {
+		gameData += "\nROOM big" + i + "\n";
+		for (var y = 0; y < 16; y++) {
+			gameData += roomRow;
+		}
+		gameData += "NAME big room " + i + "\nPAL " + (i % 2) + "\n";
+
+		gameData += "\nTIL t" + i + "\n";
+		for (var y = 0; y < 8; y++) {
+			gameData += ((i + y) % 2 === 0) ? "10101010\n" : "01010101\n";
+		}
+		gameData += "NAME tile " + i + "\n";
+
+		gameData += "\nSPR s" + i + "\n";
+		for (var y = 0; y < 8; y++) {
+			gameData += "00111100\n";
+		}
+		gameData += "DLG d" + i + "\nPOS big" + i + " 4,4\n";
+
+		gameData += "\nDLG d" + i + "\n";
+		gameData += "\"\"\"\n{sequence\n  - hello number " + i + "\n  - {wvy}again{wvy}\n}\n{x = x + " + i + "}\n\"\"\"\n";
+		gameData += "NAME dialog " + i + "\n";
+	}
+
+	return gameData;
+}
+
+addBenchScenario("parse large world", 60, false, function() {
+	benchLargeGameData = createLargeGameData();
+}, function(frameIndex) {
+	parseWorld(benchLargeGameData);
+});
+
+addBenchScenario("tune playback", 600, true, function() {
+	soundPlayer.playTune(tune["1"]);
+}, noBenchInput);
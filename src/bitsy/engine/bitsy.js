@@ -197,7 +197,20 @@ function load_game(gameData, defaultFontData, startWithTitle) {
 function loadWorldFromGameData(gameData) {
 	bitsy.log("load world from game data");
 
-	var world = parseWorld(gameData);
+	var world = null;
+
+	// skip parsing if the system kept the world from a previous launch
+	if (bitsy.getWorldCache) {
+		world = loadWorldCache(bitsy.getWorldCache());
+	}
+
+	if (world === null) {
+		world = parseWorld(gameData);
+
+		if (bitsy.putWorldCache) {
+			bitsy.putWorldCache(createWorldCache(world));
+		}
+	}
 
 	bitsy.log("parse world done");
 
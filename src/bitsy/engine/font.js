@@ -66,6 +66,7 @@ function Font(fontData) {
 	}
 
 	this.getData = function() {
+		unpackAllGlyphs();
 		return chardata;
 	}
 
@@ -79,15 +80,16 @@ function Font(fontData) {
 
 	this.hasChar = function(char) {
 		var codepoint = char.charCodeAt(0);
-		return chardata[codepoint] != null;
+		return getCharData(codepoint) != null;
 	}
 
 	this.getChar = function(char) {
 
 		var codepoint = char.charCodeAt(0);
+		var charData = getCharData(codepoint);
 
-		if (chardata[codepoint] != null) {
-			return chardata[codepoint];
+		if (charData != null) {
+			return charData;
 		}
 		else {
 			return invalidCharData;
@@ -95,6 +97,8 @@ function Font(fontData) {
 	}
 
 	this.allCharCodes = function() {
+		unpackAllGlyphs();
+
 		var codeList = [];
 		for (var code in chardata) {
 			codeList.push(code);
@@ -230,8 +234,198 @@ function Font(fontData) {
 		updateInvalidCharData();
 	}
 
-	bitsy.log("parse font");
-	parseFont(fontData);
+	/* GLYPH TABLES */
+	// a glyph table is a prebaked binary version of a font
+	// (so it can be loaded without parsing the text format) laid out like this:
+	// "BFNT", version (1), width, height, name length, name,
+	// glyph count (u32), glyph entries (16 bytes each, sorted by code point), glyph bitmaps
+	// each glyph entry is: code point (u32), bitmap offset (u32), width, height, offset x (signed), offset y (signed), spacing, 3 unused bytes
+	// and each glyph bitmap is 1 bit per pixel in row order (most significant bit first)
+	// multi-byte values are little endian
+	var glyphTableVersion = 1;
+	var glyphEntrySize = 16;
+
+	var glyphTable = null;
+	var glyphCount = 0;
+	var glyphEntryStart = 0;
+	var glyphBitmapStart = 0;
+
+	function isGlyphTable(fontData) {
+		return fontData != null && typeof(fontData) != "string" && fontData.length >= 4
+			&& fontData[0] === 66 && fontData[1] === 70 && fontData[2] === 78 && fontData[3] === 84; // "BFNT"
+	}
+
+	function readUint32(bytes, i) {
+		return (bytes[i] | (bytes[i + 1] << 8) | (bytes[i + 2] << 16) | (bytes[i + 3] << 24)) >>> 0;
+	}
+
+	function readInt8(bytes, i) {
+		return (bytes[i] << 24) >> 24;
+	}
+
+	function loadGlyphTable(table) {
+		if (table[4] != glyphTableVersion) {
+			bitsy.log("unsupported glyph table version " + table[4]);
+			return;
+		}
+
+		width = table[5];
+		height = table[6];
+
+		var nameLength = table[7];
+		name = "";
+		for (var i = 0; i < nameLength; i++) {
+			name += String.fromCharCode(table[8 + i]);
+		}
+
+		glyphTable = table;
+		glyphCount = readUint32(table, 8 + nameLength);
+		glyphEntryStart = 8 + nameLength + 4;
+		glyphBitmapStart = glyphEntryStart + (glyphCount * glyphEntrySize);
+
+		updateInvalidCharData();
+	}
+
+	// binary search for the glyph's entry - returns -1 if the font doesn't have it
+	function findGlyph(codepoint) {
+		var lo = 0;
+		var hi = glyphCount - 1;
+
+		while (lo <= hi) {
+			var mid = (lo + hi) >> 1;
+			var midCodepoint = readUint32(glyphTable, glyphEntryStart + (mid * glyphEntrySize));
+
+			if (midCodepoint === codepoint) {
+				return mid;
+			}
+			else if (midCodepoint < codepoint) {
+				lo = mid + 1;
+			}
+			else {
+				hi = mid - 1;
+			}
+		}
+
+		return -1;
+	}
+
+	function unpackGlyph(glyphIndex) {
+		var entry = glyphEntryStart + (glyphIndex * glyphEntrySize);
+		var codepoint = readUint32(glyphTable, entry);
+		var bitmap = glyphBitmapStart + readUint32(glyphTable, entry + 4);
+
+		var charData = createCharData();
+		charData.width = glyphTable[entry + 8];
+		charData.height = glyphTable[entry + 9];
+		charData.offset.x = readInt8(glyphTable, entry + 10);
+		charData.offset.y = readInt8(glyphTable, entry + 11);
+		charData.spacing = glyphTable[entry + 12];
+
+		var pixelCount = charData.width * charData.height;
+		for (var i = 0; i < pixelCount; i++) {
+			charData.data.push((glyphTable[bitmap + (i >> 3)] >> (7 - (i & 7))) & 1);
+		}
+
+		chardata[codepoint] = charData;
+
+		return charData;
+	}
+
+	function unpackAllGlyphs() {
+		if (glyphTable === null) {
+			return;
+		}
+
+		for (var i = 0; i < glyphCount; i++) {
+			var codepoint = readUint32(glyphTable, glyphEntryStart + (i * glyphEntrySize));
+			if (chardata[codepoint] === undefined) {
+				unpackGlyph(i);
+			}
+		}
+	}
+
+	// glyphs from a glyph table are only unpacked when they're first used
+	function getCharData(codepoint) {
+		if (chardata[codepoint] != null) {
+			return chardata[codepoint];
+		}
+
+		if (glyphTable != null) {
+			var glyphIndex = findGlyph(codepoint);
+			if (glyphIndex >= 0) {
+				return unpackGlyph(glyphIndex);
+			}
+		}
+
+		return null;
+	}
+
+	this.createGlyphTable = function() {
+		unpackAllGlyphs();
+
+		var codepoints = [];
+		for (var code in chardata) {
+			codepoints.push(parseInt(code));
+		}
+		codepoints.sort(function(a, b) { return a - b; });
+
+		var headerSize = 8 + name.length + 4;
+		var bitmapSize = 0;
+		for (var i = 0; i < codepoints.length; i++) {
+			var charData = chardata[codepoints[i]];
+			bitmapSize += Math.ceil((charData.width * charData.height) / 8);
+		}
+
+		var table = new Uint8Array(headerSize + (codepoints.length * glyphEntrySize) + bitmapSize);
+
+		function writeUint32(i, value) {
+			table[i] = value & 0xff;
+			table[i + 1] = (value >> 8) & 0xff;
+			table[i + 2] = (value >> 16) & 0xff;
+			table[i + 3] = (value >> 24) & 0xff;
+		}
+
+		table.set([66, 70, 78, 84, glyphTableVersion, width, height, name.length], 0);
+		for (var i = 0; i < name.length; i++) {
+			table[8 + i] = name.charCodeAt(i) & 0xff;
+		}
+		writeUint32(8 + name.length, codepoints.length);
+
+		var entry = headerSize;
+		var bitmapStart = headerSize + (codepoints.length * glyphEntrySize);
+		var bitmapOffset = 0;
+		for (var i = 0; i < codepoints.length; i++) {
+			var charData = chardata[codepoints[i]];
+
+			writeUint32(entry, codepoints[i]);
+			writeUint32(entry + 4, bitmapOffset);
+			table[entry + 8] = charData.width;
+			table[entry + 9] = charData.height;
+			table[entry + 10] = charData.offset.x & 0xff;
+			table[entry + 11] = charData.offset.y & 0xff;
+			table[entry + 12] = charData.spacing;
+
+			for (var j = 0; j < charData.data.length; j++) {
+				if (charData.data[j] === 1) {
+					table[bitmapStart + bitmapOffset + (j >> 3)] |= (1 << (7 - (j & 7)));
+				}
+			}
+
+			entry += glyphEntrySize;
+			bitmapOffset += Math.ceil((charData.width * charData.height) / 8);
+		}
+
+		return table;
+	}
+
+	if (isGlyphTable(fontData)) {
+		bitsy.log("load glyph table");
+		loadGlyphTable(fontData);
+	}
+	else {
+		bitsy.log("parse font");
+		parseFont(fontData);
+	}
 
 	bitsy.log("create font");
 }
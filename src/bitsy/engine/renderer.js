@@ -1,5 +1,5 @@
 function TileRenderer(debugName) {
-bitsy.log("!!!!! NEW TILE RENDERER: " + debugName);
+bitsy.log("!!!!! NEW TILE RENDERER: " + debugName, bitsy.LOG_INFO, "renderer");
 
 var drawingCache = {
 	source: {},
@@ -32,8 +32,8 @@ function renderDrawing(drawing) {
 		var frameData = drawingFrames[i];
 		var frameTileId = renderTileFromDrawingData(frameData, col, bgc);
 
-		if (drawing.id === "b") {
-			bitsy.log("RENDER FRAME " + i + " drawing: " + drawing.id + " tile: " + frameTileId);
+		if (drawing.id === "b" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {
+			bitsy.log("RENDER FRAME " + i + " drawing: " + drawing.id + " tile: " + frameTileId, bitsy.LOG_DEBUG, "renderer");
 		}
 
 		drawingCache.render[cacheId].push(frameTileId);
@@ -49,15 +49,15 @@ function renderTileFromDrawingData(drawingData, col, bgc) {
 	bitsy.fill(tileId, backgroundColor);
 
 	for (var y = 0; y < bitsy.TILE_SIZE; y++) {
-		if (tileId === 4) {
-			bitsy.log(">> " + drawingData[y]);
+		if (tileId === 4 && bitsy.LOG_LEVEL >= bitsy.LOG_TRACE) {
+			bitsy.log(">> " + drawingData[y], bitsy.LOG_TRACE, "renderer");
 		}
 
 		for (var x = 0; x < bitsy.TILE_SIZE; x++) {
 			var px = drawingData[y][x];
 			if (px === 1) {
-				if (tileId === 4) {
-					bitsy.log("! set pixel: " + tileId + ": " + x + "," + y + " " + foregroundColor);
+				if (tileId === 4 && bitsy.LOG_LEVEL >= bitsy.LOG_TRACE) {
+					bitsy.log("! set pixel: " + tileId + ": " + x + "," + y + " " + foregroundColor, bitsy.LOG_TRACE, "renderer");
 				}
 				bitsy.set(tileId, (y * bitsy.TILE_SIZE) + x, foregroundColor);
 			}
@@ -96,20 +96,23 @@ function getDrawingFrameTileId(drawing, frameOverride) {
 
 	var tileId = getRenderedDrawingFrames(drawing)[frameIndex];
 
-	if (drawing.id === "b") {
-		bitsy.log("GET TILE ID " + drawing.id + " - " + tileId);
+	if (drawing.id === "b" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {
+		bitsy.log("GET TILE ID " + drawing.id + " - " + tileId, bitsy.LOG_DEBUG, "renderer");
 	}
 
 	return tileId;
 }
 
 function getOrRenderDrawingFrame(drawing, frameOverride) {
-	if (drawing.id === "b") {
-		bitsy.log("frame render: " + drawing.type + " " + drawing.id + " f:" + frameOverride);
+	if (drawing.id === "b" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {
+		bitsy.log("frame render: " + drawing.type + " " + drawing.id + " f:" + frameOverride, bitsy.LOG_DEBUG, "renderer");
 	}
 
 	if (!isDrawingRendered(drawing)) {
-		bitsy.log("frame render: doesn't exist " + drawing.id);
+		if (bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {
+			bitsy.log("frame render: doesn't exist " + drawing.id, bitsy.LOG_DEBUG, "renderer");
+		}
+
 		renderDrawing(drawing);
 	}
 
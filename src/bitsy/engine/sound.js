@@ -155,6 +155,12 @@ function SoundPlayer() {
 	var maxBeatCount = null;
 	var muteTimer = 0; // allow temporary muting of all notes
 
+	// tunes are handed off to the system's sequencer when it has one, so they stay in time
+	// even when a frame runs long (it doesn't handle blips or the editor options though)
+	var isNativeSequencerEnabled = (bitsy.tune != undefined);
+	var isNativeTune = false;
+	var isNativeTunePaused = false;
+
 	function arpeggiateBar(bar, key, pattern) {
 		var arpeggio = [];
 
@@ -198,6 +204,63 @@ function SoundPlayer() {
 		}
 	}
 
+	function hasBlipNotes(tune) {
+		for (var i = 0; i < tune.melody.length; i++) {
+			for (var j = 0; j < barLength; j++) {
+				var pitchA = tune.melody[i][j];
+				var pitchB = tune.harmony[i][j];
+				if ((pitchA.blip != undefined && pitchA.beats > 0) || (pitchB.blip != undefined && pitchB.beats > 0)) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	function pushSequencerNote(notes, pitch, key) {
+		if (pitch != undefined && isPitchPlayable(pitch, key)) {
+			notes.push(makePitchFrequency(pitchToChromatic(pitch, key)) * 100, pitch.beats);
+		}
+		else {
+			notes.push(0, 0);
+		}
+	}
+
+	function startNativeTune(tune) {
+		var melody = [];
+		var harmony = [];
+
+		for (var i = 0; i < tune.melody.length; i++) {
+			var arpeggio = [];
+			if (tune.arpeggioPattern != ArpeggioPattern.OFF && tune.key != null) {
+				arpeggio = arpeggiateBar(tune.harmony[i], tune.key, tune.arpeggioPattern);
+			}
+
+			for (var j = 0; j < barLength; j++) {
+				pushSequencerNote(melody, tune.melody[i][j], tune.key);
+
+				if (tune.arpeggioPattern === ArpeggioPattern.OFF) {
+					pushSequencerNote(harmony, tune.harmony[i][j], tune.key);
+				}
+				else {
+					pushSequencerNote(harmony, arpeggio[j % arpeggio.length], null);
+				}
+			}
+		}
+
+		bitsy.tune(melody, harmony, beat16, tune.instrumentA, tune.instrumentB, noteVolume);
+		isNativeTunePaused = false;
+	}
+
+	function updateNativeTunePause() {
+		var isPaused = isTunePaused || isMusicPausedForBlip;
+		if (isNativeTune && isPaused != isNativeTunePaused) {
+			bitsy.tunePause(isPaused);
+			isNativeTunePaused = isPaused;
+		}
+	}
+
 	function sfxFrequencyAtTime(sfx, time) {
 		var beatDelay = sfx.blip.beat.delay;
 		var beatTime = sfx.blip.beat.time;
@@ -270,22 +333,26 @@ function SoundPlayer() {
 				sfx.timer = sfx.duration;
 			}
 
-			if (sfx.frequencies.length > 0) {
+			// the system plays native blips on its own, so they only need their timer updated
+			if (!isNativeBlip && sfx.frequencies.length > 0) {
 				// update pitch
 				var prevPitchIndex = sfx.pitchIndex;
 				var freq = sfxFrequencyAtTime(sfx, sfx.timer);
 				if (prevPitchIndex != sfx.pitchIndex) {
 					// pitch changed!
-					bitsy.frequency(bitsy.SOUND1, freq * 100);
+					bitsy.frequency(sfxChannel, freq * 100);
 				}
 
 				// update volume envelope
-				bitsy.volume(bitsy.SOUND1, sfxVolumeAtTime(sfx, sfx.timer));
+				bitsy.volume(sfxChannel, sfxVolumeAtTime(sfx, sfx.timer));
 			}
 
 			if (sfx.timer >= sfx.duration) {
 				// turn off sound
-				bitsy.volume(bitsy.SOUND1, 0);
+				if (!isNativeBlip) {
+					bitsy.volume(sfxChannel, 0);
+				}
+
 				activeSfx = null;
 			}
 		}
@@ -326,7 +393,7 @@ function SoundPlayer() {
 				if (!isMelodyMuted) {
 					// melody note
 					var pitchA = curTune.melody[barIndex][beat16Index];
-					if (pitchA.beats > 0) {
+					if (pitchA.beats > 0 && sfxChannel === bitsy.SOUND1) {
 						// since they're played on the same channel, any melody note will cancel a blip
 						activeSfx = null;
 					}
@@ -366,12 +433,19 @@ function SoundPlayer() {
 
 	this.update = function(dt) {
 		updateSfx(dt);
-		if (!isTunePaused && !isMusicPausedForBlip) {
+		if (isNativeTune) {
+			updateNativeTunePause();
+		}
+		else if (!isTunePaused && !isMusicPausedForBlip) {
 			updateTune(dt);
 		}
 	};
 
 	this.playTune = function(tune, options) {
+		if (isNativeTune) {
+			bitsy.tuneStop();
+		}
+
 		curTune = tune;
 		beat16Timer = 0;
 		beat16Index = -1;
@@ -403,11 +477,21 @@ function SoundPlayer() {
 		// update tempo
 		beat16 = tempos[curTune.tempo];
 
-		if (curTune.arpeggioPattern != ArpeggioPattern.OFF && curTune.key != null) {
+		isNativeTune = isNativeSequencerEnabled && options === undefined && !hasBlipNotes(curTune);
+
+		if (isNativeTune) {
+			startNativeTune(curTune);
+			updateNativeTunePause();
+		}
+		else if (curTune.arpeggioPattern != ArpeggioPattern.OFF && curTune.key != null) {
 			curArpeggio = arpeggiateBar(curTune.harmony[barIndex], curTune.key, curTune.arpeggioPattern);
 		}
 	};
 
+	this.setNativeSequencerEnabled = function(enabled) {
+		isNativeSequencerEnabled = enabled && (bitsy.tune != undefined);
+	};
+
 	this.isTunePlaying = function() {
 		return curTune != null;
 	};
@@ -421,15 +505,22 @@ function SoundPlayer() {
 	};
 
 	this.stopTune = function() {
+		if (isNativeTune) {
+			bitsy.tuneStop();
+			isNativeTune = false;
+		}
+
 		curTune = null;
 	};
 
 	this.pauseTune = function() {
 		isTunePaused = true;
+		updateNativeTunePause();
 	};
 
 	this.resumeTune = function() {
 		isTunePaused = false;
+		updateNativeTunePause();
 	};
 
 	this.getBeat = function() {
@@ -437,12 +528,32 @@ function SoundPlayer() {
 			return null;
 		}
 
+		if (isNativeTune) {
+			var step = bitsy.tuneBeat();
+			return {
+				bar : step < 0 ? 0 : Math.floor(step / barLength),
+				beat : step < 0 ? -1 : (step % barLength),
+			};
+		}
+
 		return {
 			bar : barIndex,
 			beat : beat16Index,
 		};
 	};
 
+	// length of one loop of the current tune: the number of sixteenth note steps and the length of each (in ms)
+	this.getTuneLength = function() {
+		if (curTune == null) {
+			return null;
+		}
+
+		return {
+			steps : curTune.melody.length * barLength,
+			beat : beat16,
+		};
+	};
+
 	this.getBlipState = function() {
 		return activeSfx;
 	};
@@ -466,6 +577,12 @@ function SoundPlayer() {
 	var activeSfx = null;
 	var isMusicPausedForBlip = false;
 
+	// when the system supports it, blip envelopes are evaluated per sample instead of once per frame
+	var isNativeBlip = (bitsy.blip != undefined);
+
+	// if the system has more than two sound channels, blips get their own so they don't cut off the melody
+	var sfxChannel = (bitsy.SOUND3 != undefined) ? bitsy.SOUND3 : bitsy.SOUND1;
+
 	function createSfxState(blip, pitch, isPitchRandomized) {
 		// bitsy.log("init sfx blip: " + blip.id);
 
@@ -506,23 +623,42 @@ function SoundPlayer() {
 		// default to pausing music while the blip plays (except when playing a blip as *part* of music)
 		isMusicPausedForBlip = (options === undefined || options.interruptMusic === undefined) ? true : options.interruptMusic;
 
-		// always play blips on channel 1
-		var channel = bitsy.SOUND1;
+		// always play blips on the same channel
+		var channel = sfxChannel;
 
 		// other options
 		var pitch = (options === undefined || options.pitch === undefined) ? null : options.pitch;
 		var isPitchRandomized = (options === undefined || options.isPitchRandomized === undefined) ? false : options.isPitchRandomized;
 		var key = (options != undefined && options.key != undefined) ? options.key : null;
 
+		updateNativeTunePause();
+
 		activeSfx = createSfxState(blip, pitchToChromatic(pitch, key), isPitchRandomized);
 		bitsy.log("play blip: " + activeSfx.frequencies);
 
-		bitsy.sound(
-			channel,
-			activeSfx.duration * 10, // HACK : mult by 10 is to avoid accidentally turning off early
-			activeSfx.frequencies.length > 0 ? (activeSfx.frequencies[0] * 100) : 0,
-			0, // volume
-			activeSfx.blip.instrument);
+		if (isNativeBlip) {
+			bitsy.blip(channel, {
+				attack: blip.envelope.attack,
+				decay: blip.envelope.decay,
+				length: blip.envelope.length,
+				release: blip.envelope.release,
+				peak: sfxPeakVolume,
+				sustain: blip.envelope.sustain,
+				frequencies: activeSfx.frequencies.map(function(freq) { return freq * 100; }),
+				stepDelay: blip.beat.delay,
+				stepTime: blip.beat.time,
+				repeat: blip.doRepeat,
+				pulse: blip.instrument,
+			});
+		}
+		else {
+			bitsy.sound(
+				channel,
+				activeSfx.duration * 10, // HACK : mult by 10 is to avoid accidentally turning off early
+				activeSfx.frequencies.length > 0 ? (activeSfx.frequencies[0] * 100) : 0,
+				0, // volume
+				activeSfx.blip.instrument);
+		}
 	};
 
 	this.playBlip = playBlip;
@@ -8,7 +8,7 @@ var TransitionManager = function() {
 	var curStep = 0;
 
 	this.BeginTransition = function(startRoom, startX, startY, endRoom, endX, endY, effectName) {
-		bitsy.log("--- START ROOM TRANSITION ---");
+		bitsy.log("--- START ROOM TRANSITION ---", bitsy.LOG_INFO, "transition");
 
 		curEffect = effectName;
 
@@ -68,7 +68,9 @@ var TransitionManager = function() {
 			curStep++;
 
 			var step = curStep;
-			bitsy.log("transition step " + step);
+			if (bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {
+				bitsy.log("transition step " + step, bitsy.LOG_DEBUG, "transition");
+			}
 
 			if (transitionEffects[curEffect].paletteEffectFunc) {
 				var colors = transitionEffects[curEffect].paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));
@@ -113,6 +113,8 @@ function createWorldData() {
 		names : {},
 		// source data for all drawings (todo: better name?)
 		drawings : {},
+		// raw data for fonts embedded in the game file (keyed by font filename)
+		fonts : {},
 	};
 }
 
@@ -902,6 +904,7 @@ function parseFontData(parseState, world) {
 
 	var localFontFilename = localFontName + fontManager.GetExtension();
 	fontManager.AddResource( localFontFilename, localFontData );
+	world.fonts[localFontFilename] = localFontData;
 
 	return i;
 }
@@ -1236,4 +1239,93 @@ function getArg(line,arg) {
 function getNameArg(line) {
 	var name = line.split(/\s(.+)/)[1];
 	return name;
+}
+
+/* WORLD CACHE */
+// the system can store a parsed world between launches so it doesn't need to be re-parsed:
+// everything is kept as-is except drawings, which are packed into one byte per row,
+// and embedded fonts, which are stored as glyph tables
+function createWorldCache(world) {
+	var cache = {
+		engineVersion : getEngineVersion(),
+		world : {},
+	};
+
+	for (var key in world) {
+		cache.world[key] = world[key];
+	}
+
+	cache.world.drawings = {};
+	for (var drwId in world.drawings) {
+		cache.world.drawings[drwId] = packDrawingFrames(world.drawings[drwId]);
+	}
+
+	// embedded fonts are stored as glyph tables so they don't need to be parsed either
+	if (fontManager) {
+		cache.world.fonts = {};
+		for (var fontFilename in world.fonts) {
+			cache.world.fonts[fontFilename] = fontManager.Create(world.fonts[fontFilename]).createGlyphTable();
+		}
+	}
+
+	return cache;
+}
+
+// returns null if there's no usable cache (so the caller knows to parse the game data instead)
+function loadWorldCache(cache) {
+	if (cache === undefined || cache === null || cache.engineVersion != getEngineVersion()) {
+		return null;
+	}
+
+	var world = cache.world;
+
+	for (var drwId in world.drawings) {
+		world.drawings[drwId] = unpackDrawingFrames(world.drawings[drwId]);
+	}
+
+	// fonts are normally registered as a side effect of parsing
+	if (fontManager) {
+		for (var fontFilename in world.fonts) {
+			fontManager.AddResource(fontFilename, world.fonts[fontFilename]);
+		}
+	}
+
+	return world;
+}
+
+function packDrawingFrames(frameList) {
+	var packed = new Uint8Array(frameList.length * bitsy.TILE_SIZE);
+
+	for (var f = 0; f < frameList.length; f++) {
+		for (var y = 0; y < bitsy.TILE_SIZE; y++) {
+			var rowBits = 0;
+			for (var x = 0; x < bitsy.TILE_SIZE; x++) {
+				if (frameList[f][y][x] === 1) {
+					rowBits |= (1 << (bitsy.TILE_SIZE - 1 - x));
+				}
+			}
+			packed[(f * bitsy.TILE_SIZE) + y] = rowBits;
+		}
+	}
+
+	return packed;
+}
+
+function unpackDrawingFrames(packed) {
+	var frameList = [];
+
+	for (var f = 0; f < (packed.length / bitsy.TILE_SIZE); f++) {
+		var frame = [];
+		for (var y = 0; y < bitsy.TILE_SIZE; y++) {
+			var rowBits = packed[(f * bitsy.TILE_SIZE) + y];
+			var row = [];
+			for (var x = 0; x < bitsy.TILE_SIZE; x++) {
+				row.push((rowBits >> (bitsy.TILE_SIZE - 1 - x)) & 1);
+			}
+			frame.push(row);
+		}
+		frameList.push(frame);
+	}
+
+	return frameList;
 }
\ No newline at end of file
@@ -0,0 +1,286 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+char* bench_bitsy =
+	"bench\n"
+	"\n"
+	"# BITSY VERSION 8.12\n"
+	"\n"
+	"! VER_MAJ 8\n"
+	"! VER_MIN 12\n"
+	"! ROOM_FORMAT 1\n"
+	"! DLG_COMPAT 0\n"
+	"! TXT_MODE 0\n"
+	"\n"
+	"PAL 0\n"
+	"0,82,204\n"
+	"128,159,255\n"
+	"255,255,255\n"
+	"NAME blueprint\n"
+	"\n"
+	"PAL 1\n"
+	"40,20,60\n"
+	"250,120,80\n"
+	"255,240,200\n"
+	"NAME dusk\n"
+	"\n"
+	"ROOM 0\n"
+	"a,a,a,a,a,a,a,a,a,a,a,a,a,a,a,a\n"
+	"a,c,b,0,0,b,c,0,b,0,0,b,0,0,b,a\n"
+	"a,b,0,c,b,0,0,b,c,0,b,0,0,b,0,a\n"
+	"a,0,c,b,0,0,b,c,0,b,0,0,b,0,0,a\n"
+	"a,0,b,0,c,b,0,0,b,c,0,b,0,0,b,a\n"
+	"a,b,0,0,b,0,0,b,0,0,b,0,0,b,0,a\n"
+	"a,c,0,b,0,0,b,0,0,b,0,c,b,0,0,a\n"
+	"a,0,b,c,0,b,0,0,b,0,0,b,0,c,b,a\n"
+	"a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,a\n"
+	"a,0,0,b,c,0,b,0,0,b,0,0,b,0,c,a\n"
+	"a,0,b,0,0,b,0,0,b,0,0,b,0,0,b,a\n"
+	"a,b,0,0,b,0,c,b,0,0,b,c,0,b,0,a\n"
+	"a,0,0,b,0,0,b,0,c,b,0,0,b,c,0,a\n"
+	"a,0,b,0,0,b,0,c,b,0,0,b,c,0,b,a\n"
+	"a,b,0,0,b,0,0,b,0,c,b,0,0,b,c,a\n"
+	"a,a,a,a,a,a,a,a,a,a,a,a,a,a,a,a\n"
+	"NAME busy room\n"
+	"PAL 0\n"
+	"\n"
+	"ROOM 1\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"c,b,c,b,c,b,c,b,c,b,c,b,c,b,c,b\n"
+	"b,c,b,c,b,c,b,c,b,c,b,c,b,c,b,c\n"
+	"NAME checkerboard\n"
+	"PAL 1\n"
+	"\n"
+	"TIL a\n"
+	"11111111\n"
+	"10000001\n"
+	"10111101\n"
+	"10100101\n"
+	"10100101\n"
+	"10111101\n"
+	"10000001\n"
+	"11111111\n"
+	"NAME wall\n"
+	"WAL true\n"
+	"\n"
+	"TIL b\n"
+	"00011000\n"
+	"00111100\n"
+	"01100110\n"
+	"11000011\n"
+	"11000011\n"
+	"01100110\n"
+	"00111100\n"
+	"00011000\n"
+	">\n"
+	"00000000\n"
+	"00011000\n"
+	"00111100\n"
+	"01100110\n"
+	"01100110\n"
+	"00111100\n"
+	"00011000\n"
+	"00000000\n"
+	"NAME pulse\n"
+	"\n"
+	"TIL c\n"
+	"10101010\n"
+	"01010101\n"
+	"10101010\n"
+	"01010101\n"
+	"10101010\n"
+	"01010101\n"
+	"10101010\n"
+	"01010101\n"
+	"NAME dither\n"
+	"\n"
+	"SPR A\n"
+	"00011000\n"
+	"00011000\n"
+	"00011000\n"
+	"00111100\n"
+	"01111110\n"
+	"10111101\n"
+	"00100100\n"
+	"00100100\n"
+	"POS 0 1,8\n"
+	"\n"
+	"SPR a\n"
+	"00000000\n"
+	"00000000\n"
+	"01010001\n"
+	"01110001\n"
+	"01110010\n"
+	"01111100\n"
+	"00111100\n"
+	"00100100\n"
+	">\n"
+	"00000000\n"
+	"01010001\n"
+	"01110001\n"
+	"01110010\n"
+	"01111100\n"
+	"00111100\n"
+	"00100100\n"
+	"00000000\n"
+	"NAME cat\n"
+	"POS 0 14,1\n"
+	"\n"
+	"TUNE 1\n"
+	"3d,0,0,0,3d5,0,0,0,3l,0,0,0,3s,0,0,0\n"
+	"16d2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+	">\n"
+	"4l,0,0,0,s,0,3l,0,0,0,2s,0,2m,0,2r,0\n"
+	"16m2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+	">\n"
+	"3d,0,0,0,3d5,0,0,0,3l,0,0,0,3s,0,0,0\n"
+	"16l2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+	">\n"
+	"3l,0,0,0,s,0,4m,0,0,0,4r,0,0,0,0,0\n"
+	"16s2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+	"NAME finale fanfare\n"
+	"KEY C,D,E,F,G,A,B d,r,m,s,l\n"
+	"TMP XFST\n"
+	"SQR P2 P8\n"
+	"ARP INT8\n"
+	"\n"
+	"\n";
+
+char* bench_js =
+	"// benchmark scenarios for `--bench`: each one runs on a fresh engine with bench.bitsy loaded\n"
+	"// (skipping the title), then `frame` is called before every frame and returns the buttons to\n"
+	"// hold, using the same names as input scripts (\"up\", \"down\", \"left\", \"right\", \"ok\", \"menu\")\n"
+	"var __bitsybox_bench_scenarios__ = [];\n"
+	"\n"
+	"function addBenchScenario(name, frameCount, isEngineUpdated, setup, frame) {\n"
+	"	__bitsybox_bench_scenarios__.push({\n"
+	"		name: name,\n"
+	"		frameCount: frameCount,\n"
+	"		isEngineUpdated: isEngineUpdated,\n"
+	"		setup: setup,\n"
+	"		frame: frame,\n"
+	"	});\n"
+	"}\n"
+	"\n"
+	"function __bitsybox_bench_setup__(index) {\n"
+	"	load_game(bitsy.getGameData(), bitsy.getFontData(), false);\n"
+	"	__bitsybox_bench_scenarios__[index].setup();\n"
+	"}\n"
+	"\n"
+	"function __bitsybox_bench_frame__(index, frameIndex) {\n"
+	"	var buttons = __bitsybox_bench_scenarios__[index].frame(frameIndex);\n"
+	"	return buttons ? buttons : \"\";\n"
+	"}\n"
+	"\n"
+	"function noBenchSetup() {\n"
+	"}\n"
+	"\n"
+	"function noBenchInput(frameIndex) {\n"
+	"	return \"\";\n"
+	"}\n"
+	"\n"
+	"// redraws every tile of the room each frame (without running the rest of the engine)\n"
+	"addBenchScenario(\"room redraw\", 600, false, noBenchSetup, function(frameIndex) {\n"
+	"	drawRoom(room[state.room], { redrawAll: true, frameIndex: frameIndex % 2 });\n"
+	"});\n"
+	"\n"
+	"// walks the avatar back and forth along the open row of the room\n"
+	"addBenchScenario(\"avatar walk\", 600, true, noBenchSetup, function(frameIndex) {\n"
+	"	return (Math.floor(frameIndex / 120) % 2) === 0 ? \"right\" : \"left\";\n"
+	"});\n"
+	"\n"
+	"// goes back and forth between the two rooms using one transition effect\n"
+	"function addTransitionScenario(effectName) {\n"
+	"	addBenchScenario(\"transition \" + effectName, 300, true, noBenchSetup, function(frameIndex) {\n"
+	"		if (transition.IsTransitionActive()) {\n"
+	"			return;\n"
+	"		}\n"
+	"\n"
+	"		var endRoom = state.room === \"0\" ? \"1\" : \"0\";\n"
+	"		transition.BeginTransition(state.room, player().x, player().y, endRoom, player().x, player().y, effectName);\n"
+	"		transition.UpdateTransition(0);\n"
+	"		transition.OnTransitionComplete(function() {\n"
+	"			state.room = endRoom;\n"
+	"			initRoom(state.room);\n"
+	"		});\n"
+	"	});\n"
+	"}\n"
+	"\n"
+	"var benchTransitionEffects = [\"fade_w\", \"fade_b\", \"wave\", \"tunnel\", \"slide_u\", \"slide_d\", \"slide_l\", \"slide_r\"];\n"
+	"for (var i = 0; i < benchTransitionEffects.length; i++) {\n"
+	"	addTransitionScenario(benchTransitionEffects[i]);\n"
+	"}\n"
+	"\n"
+	"// types out a page of text effects, closes it, then starts over\n"
+	"var benchDialog = \"{wvy}wavy words{wvy} and {shk}shaky words{shk} and {rbw}rainbow words{rbw} all at once\";\n"
+	"\n"
+	"addBenchScenario(\"dialog effects\", 600, true, function() {\n"
+	"	startDialog(benchDialog);\n"
+	"}, function(frameIndex) {\n"
+	"	if (!dialogBuffer.IsActive()) {\n"
+	"		startDialog(benchDialog);\n"
+	"	}\n"
+	"\n"
+	"	// one frame presses, so the engine sees a new press each time\n"
+	"	return (frameIndex % 120) === 119 ? \"ok\" : \"\";\n"
+	"});\n"
+	"\n"
+	"// the bench game with a couple hundred more rooms, tiles, sprites and dialogs\n"
+	"var benchLargeGameData = null;\n"
+	"\n"
+	"function createLargeGameData() {\n"
+	"	var gameData = bitsy.getGameData();\n"
+	"	var roomRow = \"a,b,c,0,a,b,c,0,a,b,c,0,a,b,c,0\\n\";\n"
+	"\n"
+	"	for (var i = 0; i < 200; i++) {\n"
+	"		gameData += \"\\nROOM big\" + i + \"\\n\";\n"
+	"		for (var y = 0; y < 16; y++) {\n"
+	"			gameData += roomRow;\n"
+	"		}\n"
+	"		gameData += \"NAME big room \" + i + \"\\nPAL \" + (i % 2) + \"\\n\";\n"
+	"\n"
+	"		gameData += \"\\nTIL t\" + i + \"\\n\";\n"
+	"		for (var y = 0; y < 8; y++) {\n"
+	"			gameData += ((i + y) % 2 === 0) ? \"10101010\\n\" : \"01010101\\n\";\n"
+	"		}\n"
+	"		gameData += \"NAME tile \" + i + \"\\n\";\n"
+	"\n"
+	"		gameData += \"\\nSPR s\" + i + \"\\n\";\n"
+	"		for (var y = 0; y < 8; y++) {\n"
+	"			gameData += \"00111100\\n\";\n"
+	"		}\n"
+	"		gameData += \"DLG d\" + i + \"\\nPOS big\" + i + \" 4,4\\n\";\n"
+	"\n"
+	"		gameData += \"\\nDLG d\" + i + \"\\n\";\n"
+	"		gameData += \"\\\"\\\"\\\"\\n{sequence\\n  - hello number \" + i + \"\\n  - {wvy}again{wvy}\\n}\\n{x = x + \" + i + \"}\\n\\\"\\\"\\\"\\n\";\n"
+	"		gameData += \"NAME dialog \" + i + \"\\n\";\n"
+	"	}\n"
+	"\n"
+	"	return gameData;\n"
+	"}\n"
+	"\n"
+	"addBenchScenario(\"parse large world\", 60, false, function() {\n"
+	"	benchLargeGameData = createLargeGameData();\n"
+	"}, function(frameIndex) {\n"
+	"	parseWorld(benchLargeGameData);\n"
+	"});\n"
+	"\n"
+	"addBenchScenario(\"tune playback\", 600, true, function() {\n"
+	"	soundPlayer.playTune(tune[\"1\"]);\n"
+	"}, noBenchInput);\n"
+	"\n";
+
+#endif
\ No newline at end of file
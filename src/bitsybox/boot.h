@@ -305,7 +305,8 @@ char* boot_js =
 	"\n"
 	"		bootLoad(bitsy.getGameData(), bitsy.getFontData());\n"
 	"\n"
-	"		// start playing the boot tune\n"
+	"		// start playing the boot tune (stepped by the boot animation instead of the system's sequencer)\n"
+	"		soundPlayer.setNativeSequencerEnabled(false);\n"
 	"		soundPlayer.playTune(tune[\"1\"]);\n"
 	"\n"
 	"		isLoaded = true;\n"
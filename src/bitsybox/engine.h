@@ -2619,6 +2619,8 @@ char* world_js =
 	"		names : {},\n"
 	"		// source data for all drawings (todo: better name?)\n"
 	"		drawings : {},\n"
+	"		// raw data for fonts embedded in the game file (keyed by font filename)\n"
+	"		fonts : {},\n"
 	"	};\n"
 	"}\n"
 	"\n"
@@ -3408,6 +3410,7 @@ char* world_js =
 	"\n"
 	"	var localFontFilename = localFontName + fontManager.GetExtension();\n"
 	"	fontManager.AddResource( localFontFilename, localFontData );\n"
+	"	world.fonts[localFontFilename] = localFontData;\n"
 	"\n"
 	"	return i;\n"
 	"}\n"
@@ -3742,6 +3745,95 @@ char* world_js =
 	"function getNameArg(line) {\n"
 	"	var name = line.split(/\\s(.+)/)[1];\n"
 	"	return name;\n"
+	"}\n"
+	"\n"
+	"/* WORLD CACHE */\n"
+	"// the system can store a parsed world between launches so it doesn't need to be re-parsed:\n"
+	"// everything is kept as-is except drawings, which are packed into one byte per row,\n"
+	"// and embedded fonts, which are stored as glyph tables\n"
+	"function createWorldCache(world) {\n"
+	"	var cache = {\n"
+	"		engineVersion : getEngineVersion(),\n"
+	"		world : {},\n"
+	"	};\n"
+	"\n"
+	"	for (var key in world) {\n"
+	"		cache.world[key] = world[key];\n"
+	"	}\n"
+	"\n"
+	"	cache.world.drawings = {};\n"
+	"	for (var drwId in world.drawings) {\n"
+	"		cache.world.drawings[drwId] = packDrawingFrames(world.drawings[drwId]);\n"
+	"	}\n"
+	"\n"
+	"	// embedded fonts are stored as glyph tables so they don't need to be parsed either\n"
+	"	if (fontManager) {\n"
+	"		cache.world.fonts = {};\n"
+	"		for (var fontFilename in world.fonts) {\n"
+	"			cache.world.fonts[fontFilename] = fontManager.Create(world.fonts[fontFilename]).createGlyphTable();\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	return cache;\n"
+	"}\n"
+	"\n"
+	"// returns null if there's no usable cache (so the caller knows to parse the game data instead)\n"
+	"function loadWorldCache(cache) {\n"
+	"	if (cache === undefined || cache === null || cache.engineVersion != getEngineVersion()) {\n"
+	"		return null;\n"
+	"	}\n"
+	"\n"
+	"	var world = cache.world;\n"
+	"\n"
+	"	for (var drwId in world.drawings) {\n"
+	"		world.drawings[drwId] = unpackDrawingFrames(world.drawings[drwId]);\n"
+	"	}\n"
+	"\n"
+	"	// fonts are normally registered as a side effect of parsing\n"
+	"	if (fontManager) {\n"
+	"		for (var fontFilename in world.fonts) {\n"
+	"			fontManager.AddResource(fontFilename, world.fonts[fontFilename]);\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	return world;\n"
+	"}\n"
+	"\n"
+	"function packDrawingFrames(frameList) {\n"
+	"	var packed = new Uint8Array(frameList.length * bitsy.TILE_SIZE);\n"
+	"\n"
+	"	for (var f = 0; f < frameList.length; f++) {\n"
+	"		for (var y = 0; y < bitsy.TILE_SIZE; y++) {\n"
+	"			var rowBits = 0;\n"
+	"			for (var x = 0; x < bitsy.TILE_SIZE; x++) {\n"
+	"				if (frameList[f][y][x] === 1) {\n"
+	"					rowBits |= (1 << (bitsy.TILE_SIZE - 1 - x));\n"
+	"				}\n"
+	"			}\n"
+	"			packed[(f * bitsy.TILE_SIZE) + y] = rowBits;\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	return packed;\n"
+	"}\n"
+	"\n"
+	"function unpackDrawingFrames(packed) {\n"
+	"	var frameList = [];\n"
+	"\n"
+	"	for (var f = 0; f < (packed.length / bitsy.TILE_SIZE); f++) {\n"
+	"		var frame = [];\n"
+	"		for (var y = 0; y < bitsy.TILE_SIZE; y++) {\n"
+	"			var rowBits = packed[(f * bitsy.TILE_SIZE) + y];\n"
+	"			var row = [];\n"
+	"			for (var x = 0; x < bitsy.TILE_SIZE; x++) {\n"
+	"				row.push((rowBits >> (bitsy.TILE_SIZE - 1 - x)) & 1);\n"
+	"			}\n"
+	"			frame.push(row);\n"
+	"		}\n"
+	"		frameList.push(frame);\n"
+	"	}\n"
+	"\n"
+	"	return frameList;\n"
 	"}\n";
 
 char* dialog_js =
@@ -4825,7 +4917,7 @@ char* transition_js =
 	"	var curStep = 0;\n"
 	"\n"
 	"	this.BeginTransition = function(startRoom, startX, startY, endRoom, endX, endY, effectName) {\n"
-	"		bitsy.log(\"--- START ROOM TRANSITION ---\");\n"
+	"		bitsy.log(\"--- START ROOM TRANSITION ---\", bitsy.LOG_INFO, \"transition\");\n"
 	"\n"
 	"		curEffect = effectName;\n"
 	"\n"
@@ -4885,7 +4977,9 @@ char* transition_js =
 	"			curStep++;\n"
 	"\n"
 	"			var step = curStep;\n"
-	"			bitsy.log(\"transition step \" + step);\n"
+	"			if (bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {\n"
+	"				bitsy.log(\"transition step \" + step, bitsy.LOG_DEBUG, \"transition\");\n"
+	"			}\n"
 	"\n"
 	"			if (transitionEffects[curEffect].paletteEffectFunc) {\n"
 	"				var colors = transitionEffects[curEffect].paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));\n"
@@ -5439,6 +5533,12 @@ char* sound_js =
 	"	var maxBeatCount = null;\n"
 	"	var muteTimer = 0; // allow temporary muting of all notes\n"
 	"\n"
+	"	// tunes are handed off to the system's sequencer when it has one, so they stay in time\n"
+	"	// even when a frame runs long (it doesn't handle blips or the editor options though)\n"
+	"	var isNativeSequencerEnabled = (bitsy.tune != undefined);\n"
+	"	var isNativeTune = false;\n"
+	"	var isNativeTunePaused = false;\n"
+	"\n"
 	"	function arpeggiateBar(bar, key, pattern) {\n"
 	"		var arpeggio = [];\n"
 	"\n"
@@ -5482,6 +5582,63 @@ char* sound_js =
 	"		}\n"
 	"	}\n"
 	"\n"
+	"	function hasBlipNotes(tune) {\n"
+	"		for (var i = 0; i < tune.melody.length; i++) {\n"
+	"			for (var j = 0; j < barLength; j++) {\n"
+	"				var pitchA = tune.melody[i][j];\n"
+	"				var pitchB = tune.harmony[i][j];\n"
+	"				if ((pitchA.blip != undefined && pitchA.beats > 0) || (pitchB.blip != undefined && pitchB.beats > 0)) {\n"
+	"					return true;\n"
+	"				}\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return false;\n"
+	"	}\n"
+	"\n"
+	"	function pushSequencerNote(notes, pitch, key) {\n"
+	"		if (pitch != undefined && isPitchPlayable(pitch, key)) {\n"
+	"			notes.push(makePitchFrequency(pitchToChromatic(pitch, key)) * 100, pitch.beats);\n"
+	"		}\n"
+	"		else {\n"
+	"			notes.push(0, 0);\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	function startNativeTune(tune) {\n"
+	"		var melody = [];\n"
+	"		var harmony = [];\n"
+	"\n"
+	"		for (var i = 0; i < tune.melody.length; i++) {\n"
+	"			var arpeggio = [];\n"
+	"			if (tune.arpeggioPattern != ArpeggioPattern.OFF && tune.key != null) {\n"
+	"				arpeggio = arpeggiateBar(tune.harmony[i], tune.key, tune.arpeggioPattern);\n"
+	"			}\n"
+	"\n"
+	"			for (var j = 0; j < barLength; j++) {\n"
+	"				pushSequencerNote(melody, tune.melody[i][j], tune.key);\n"
+	"\n"
+	"				if (tune.arpeggioPattern === ArpeggioPattern.OFF) {\n"
+	"					pushSequencerNote(harmony, tune.harmony[i][j], tune.key);\n"
+	"				}\n"
+	"				else {\n"
+	"					pushSequencerNote(harmony, arpeggio[j % arpeggio.length], null);\n"
+	"				}\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		bitsy.tune(melody, harmony, beat16, tune.instrumentA, tune.instrumentB, noteVolume);\n"
+	"		isNativeTunePaused = false;\n"
+	"	}\n"
+	"\n"
+	"	function updateNativeTunePause() {\n"
+	"		var isPaused = isTunePaused || isMusicPausedForBlip;\n"
+	"		if (isNativeTune && isPaused != isNativeTunePaused) {\n"
+	"			bitsy.tunePause(isPaused);\n"
+	"			isNativeTunePaused = isPaused;\n"
+	"		}\n"
+	"	}\n"
+	"\n"
 	"	function sfxFrequencyAtTime(sfx, time) {\n"
 	"		var beatDelay = sfx.blip.beat.delay;\n"
 	"		var beatTime = sfx.blip.beat.time;\n"
@@ -5554,22 +5711,26 @@ char* sound_js =
 	"				sfx.timer = sfx.duration;\n"
 	"			}\n"
 	"\n"
-	"			if (sfx.frequencies.length > 0) {\n"
+	"			// the system plays native blips on its own, so they only need their timer updated\n"
+	"			if (!isNativeBlip && sfx.frequencies.length > 0) {\n"
 	"				// update pitch\n"
 	"				var prevPitchIndex = sfx.pitchIndex;\n"
 	"				var freq = sfxFrequencyAtTime(sfx, sfx.timer);\n"
 	"				if (prevPitchIndex != sfx.pitchIndex) {\n"
 	"					// pitch changed!\n"
-	"					bitsy.frequency(bitsy.SOUND1, freq * 100);\n"
+	"					bitsy.frequency(sfxChannel, freq * 100);\n"
 	"				}\n"
 	"\n"
 	"				// update volume envelope\n"
-	"				bitsy.volume(bitsy.SOUND1, sfxVolumeAtTime(sfx, sfx.timer));\n"
+	"				bitsy.volume(sfxChannel, sfxVolumeAtTime(sfx, sfx.timer));\n"
 	"			}\n"
 	"\n"
 	"			if (sfx.timer >= sfx.duration) {\n"
 	"				// turn off sound\n"
-	"				bitsy.volume(bitsy.SOUND1, 0);\n"
+	"				if (!isNativeBlip) {\n"
+	"					bitsy.volume(sfxChannel, 0);\n"
+	"				}\n"
+	"\n"
 	"				activeSfx = null;\n"
 	"			}\n"
 	"		}\n"
@@ -5610,7 +5771,7 @@ char* sound_js =
 	"				if (!isMelodyMuted) {\n"
 	"					// melody note\n"
 	"					var pitchA = curTune.melody[barIndex][beat16Index];\n"
-	"					if (pitchA.beats > 0) {\n"
+	"					if (pitchA.beats > 0 && sfxChannel === bitsy.SOUND1) {\n"
 	"						// since they're played on the same channel, any melody note will cancel a blip\n"
 	"						activeSfx = null;\n"
 	"					}\n"
@@ -5650,12 +5811,19 @@ char* sound_js =
 	"\n"
 	"	this.update = function(dt) {\n"
 	"		updateSfx(dt);\n"
-	"		if (!isTunePaused && !isMusicPausedForBlip) {\n"
+	"		if (isNativeTune) {\n"
+	"			updateNativeTunePause();\n"
+	"		}\n"
+	"		else if (!isTunePaused && !isMusicPausedForBlip) {\n"
 	"			updateTune(dt);\n"
 	"		}\n"
 	"	};\n"
 	"\n"
 	"	this.playTune = function(tune, options) {\n"
+	"		if (isNativeTune) {\n"
+	"			bitsy.tuneStop();\n"
+	"		}\n"
+	"\n"
 	"		curTune = tune;\n"
 	"		beat16Timer = 0;\n"
 	"		beat16Index = -1;\n"
@@ -5687,11 +5855,21 @@ char* sound_js =
 	"		// update tempo\n"
 	"		beat16 = tempos[curTune.tempo];\n"
 	"\n"
-	"		if (curTune.arpeggioPattern != ArpeggioPattern.OFF && curTune.key != null) {\n"
+	"		isNativeTune = isNativeSequencerEnabled && options === undefined && !hasBlipNotes(curTune);\n"
+	"\n"
+	"		if (isNativeTune) {\n"
+	"			startNativeTune(curTune);\n"
+	"			updateNativeTunePause();\n"
+	"		}\n"
+	"		else if (curTune.arpeggioPattern != ArpeggioPattern.OFF && curTune.key != null) {\n"
 	"			curArpeggio = arpeggiateBar(curTune.harmony[barIndex], curTune.key, curTune.arpeggioPattern);\n"
 	"		}\n"
 	"	};\n"
 	"\n"
+	"	this.setNativeSequencerEnabled = function(enabled) {\n"
+	"		isNativeSequencerEnabled = enabled && (bitsy.tune != undefined);\n"
+	"	};\n"
+	"\n"
 	"	this.isTunePlaying = function() {\n"
 	"		return curTune != null;\n"
 	"	};\n"
@@ -5705,15 +5883,22 @@ char* sound_js =
 	"	};\n"
 	"\n"
 	"	this.stopTune = function() {\n"
+	"		if (isNativeTune) {\n"
+	"			bitsy.tuneStop();\n"
+	"			isNativeTune = false;\n"
+	"		}\n"
+	"\n"
 	"		curTune = null;\n"
 	"	};\n"
 	"\n"
 	"	this.pauseTune = function() {\n"
 	"		isTunePaused = true;\n"
+	"		updateNativeTunePause();\n"
 	"	};\n"
 	"\n"
 	"	this.resumeTune = function() {\n"
 	"		isTunePaused = false;\n"
+	"		updateNativeTunePause();\n"
 	"	};\n"
 	"\n"
 	"	this.getBeat = function() {\n"
@@ -5721,12 +5906,32 @@ char* sound_js =
 	"			return null;\n"
 	"		}\n"
 	"\n"
+	"		if (isNativeTune) {\n"
+	"			var step = bitsy.tuneBeat();\n"
+	"			return {\n"
+	"				bar : step < 0 ? 0 : Math.floor(step / barLength),\n"
+	"				beat : step < 0 ? -1 : (step % barLength),\n"
+	"			};\n"
+	"		}\n"
+	"\n"
 	"		return {\n"
 	"			bar : barIndex,\n"
 	"			beat : beat16Index,\n"
 	"		};\n"
 	"	};\n"
 	"\n"
+	"	// length of one loop of the current tune: the number of sixteenth note steps and the length of each (in ms)\n"
+	"	this.getTuneLength = function() {\n"
+	"		if (curTune == null) {\n"
+	"			return null;\n"
+	"		}\n"
+	"\n"
+	"		return {\n"
+	"			steps : curTune.melody.length * barLength,\n"
+	"			beat : beat16,\n"
+	"		};\n"
+	"	};\n"
+	"\n"
 	"	this.getBlipState = function() {\n"
 	"		return activeSfx;\n"
 	"	};\n"
@@ -5750,6 +5955,12 @@ char* sound_js =
 	"	var activeSfx = null;\n"
 	"	var isMusicPausedForBlip = false;\n"
 	"\n"
+	"	// when the system supports it, blip envelopes are evaluated per sample instead of once per frame\n"
+	"	var isNativeBlip = (bitsy.blip != undefined);\n"
+	"\n"
+	"	// if the system has more than two sound channels, blips get their own so they don't cut off the melody\n"
+	"	var sfxChannel = (bitsy.SOUND3 != undefined) ? bitsy.SOUND3 : bitsy.SOUND1;\n"
+	"\n"
 	"	function createSfxState(blip, pitch, isPitchRandomized) {\n"
 	"		// bitsy.log(\"init sfx blip: \" + blip.id);\n"
 	"\n"
@@ -5790,23 +6001,42 @@ char* sound_js =
 	"		// default to pausing music while the blip plays (except when playing a blip as *part* of music)\n"
 	"		isMusicPausedForBlip = (options === undefined || options.interruptMusic === undefined) ? true : options.interruptMusic;\n"
 	"\n"
-	"		// always play blips on channel 1\n"
-	"		var channel = bitsy.SOUND1;\n"
+	"		// always play blips on the same channel\n"
+	"		var channel = sfxChannel;\n"
 	"\n"
 	"		// other options\n"
 	"		var pitch = (options === undefined || options.pitch === undefined) ? null : options.pitch;\n"
 	"		var isPitchRandomized = (options === undefined || options.isPitchRandomized === undefined) ? false : options.isPitchRandomized;\n"
 	"		var key = (options != undefined && options.key != undefined) ? options.key : null;\n"
 	"\n"
+	"		updateNativeTunePause();\n"
+	"\n"
 	"		activeSfx = createSfxState(blip, pitchToChromatic(pitch, key), isPitchRandomized);\n"
 	"		bitsy.log(\"play blip: \" + activeSfx.frequencies);\n"
 	"\n"
-	"		bitsy.sound(\n"
-	"			channel,\n"
-	"			activeSfx.duration * 10, // HACK : mult by 10 is to avoid accidentally turning off early\n"
-	"			activeSfx.frequencies.length > 0 ? (activeSfx.frequencies[0] * 100) : 0,\n"
-	"			0, // volume\n"
-	"			activeSfx.blip.instrument);\n"
+	"		if (isNativeBlip) {\n"
+	"			bitsy.blip(channel, {\n"
+	"				attack: blip.envelope.attack,\n"
+	"				decay: blip.envelope.decay,\n"
+	"				length: blip.envelope.length,\n"
+	"				release: blip.envelope.release,\n"
+	"				peak: sfxPeakVolume,\n"
+	"				sustain: blip.envelope.sustain,\n"
+	"				frequencies: activeSfx.frequencies.map(function(freq) { return freq * 100; }),\n"
+	"				stepDelay: blip.beat.delay,\n"
+	"				stepTime: blip.beat.time,\n"
+	"				repeat: blip.doRepeat,\n"
+	"				pulse: blip.instrument,\n"
+	"			});\n"
+	"		}\n"
+	"		else {\n"
+	"			bitsy.sound(\n"
+	"				channel,\n"
+	"				activeSfx.duration * 10, // HACK : mult by 10 is to avoid accidentally turning off early\n"
+	"				activeSfx.frequencies.length > 0 ? (activeSfx.frequencies[0] * 100) : 0,\n"
+	"				0, // volume\n"
+	"				activeSfx.blip.instrument);\n"
+	"		}\n"
 	"	};\n"
 	"\n"
 	"	this.playBlip = playBlip;\n"
@@ -6053,7 +6283,20 @@ char* bitsy_js =
 	"function loadWorldFromGameData(gameData) {\n"
 	"	bitsy.log(\"load world from game data\");\n"
 	"\n"
-	"	var world = parseWorld(gameData);\n"
+	"	var world = null;\n"
+	"\n"
+	"	// skip parsing if the system kept the world from a previous launch\n"
+	"	if (bitsy.getWorldCache) {\n"
+	"		world = loadWorldCache(bitsy.getWorldCache());\n"
+	"	}\n"
+	"\n"
+	"	if (world === null) {\n"
+	"		world = parseWorld(gameData);\n"
+	"\n"
+	"		if (bitsy.putWorldCache) {\n"
+	"			bitsy.putWorldCache(createWorldCache(world));\n"
+	"		}\n"
+	"	}\n"
 	"\n"
 	"	bitsy.log(\"parse world done\");\n"
 	"\n"
@@ -7803,7 +8046,7 @@ char* bitsy_js =
 
 char* renderer_js =
 	"function TileRenderer(debugName) {\n"
-	"bitsy.log(\"!!!!! NEW TILE RENDERER: \" + debugName);\n"
+	"bitsy.log(\"!!!!! NEW TILE RENDERER: \" + debugName, bitsy.LOG_INFO, \"renderer\");\n"
 	"\n"
 	"var drawingCache = {\n"
 	"	source: {},\n"
@@ -7836,8 +8079,8 @@ char* renderer_js =
 	"		var frameData = drawingFrames[i];\n"
 	"		var frameTileId = renderTileFromDrawingData(frameData, col, bgc);\n"
 	"\n"
-	"		if (drawing.id === \"b\") {\n"
-	"			bitsy.log(\"RENDER FRAME \" + i + \" drawing: \" + drawing.id + \" tile: \" + frameTileId);\n"
+	"		if (drawing.id === \"b\" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {\n"
+	"			bitsy.log(\"RENDER FRAME \" + i + \" drawing: \" + drawing.id + \" tile: \" + frameTileId, bitsy.LOG_DEBUG, \"renderer\");\n"
 	"		}\n"
 	"\n"
 	"		drawingCache.render[cacheId].push(frameTileId);\n"
@@ -7853,15 +8096,15 @@ char* renderer_js =
 	"	bitsy.fill(tileId, backgroundColor);\n"
 	"\n"
 	"	for (var y = 0; y < bitsy.TILE_SIZE; y++) {\n"
-	"		if (tileId === 4) {\n"
-	"			bitsy.log(\">> \" + drawingData[y]);\n"
+	"		if (tileId === 4 && bitsy.LOG_LEVEL >= bitsy.LOG_TRACE) {\n"
+	"			bitsy.log(\">> \" + drawingData[y], bitsy.LOG_TRACE, \"renderer\");\n"
 	"		}\n"
 	"\n"
 	"		for (var x = 0; x < bitsy.TILE_SIZE; x++) {\n"
 	"			var px = drawingData[y][x];\n"
 	"			if (px === 1) {\n"
-	"				if (tileId === 4) {\n"
-	"					bitsy.log(\"! set pixel: \" + tileId + \": \" + x + \",\" + y + \" \" + foregroundColor);\n"
+	"				if (tileId === 4 && bitsy.LOG_LEVEL >= bitsy.LOG_TRACE) {\n"
+	"					bitsy.log(\"! set pixel: \" + tileId + \": \" + x + \",\" + y + \" \" + foregroundColor, bitsy.LOG_TRACE, \"renderer\");\n"
 	"				}\n"
 	"				bitsy.set(tileId, (y * bitsy.TILE_SIZE) + x, foregroundColor);\n"
 	"			}\n"
@@ -7900,20 +8143,23 @@ char* renderer_js =
 	"\n"
 	"	var tileId = getRenderedDrawingFrames(drawing)[frameIndex];\n"
 	"\n"
-	"	if (drawing.id === \"b\") {\n"
-	"		bitsy.log(\"GET TILE ID \" + drawing.id + \" - \" + tileId);\n"
+	"	if (drawing.id === \"b\" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {\n"
+	"		bitsy.log(\"GET TILE ID \" + drawing.id + \" - \" + tileId, bitsy.LOG_DEBUG, \"renderer\");\n"
 	"	}\n"
 	"\n"
 	"	return tileId;\n"
 	"}\n"
 	"\n"
 	"function getOrRenderDrawingFrame(drawing, frameOverride) {\n"
-	"	if (drawing.id === \"b\") {\n"
-	"		bitsy.log(\"frame render: \" + drawing.type + \" \" + drawing.id + \" f:\" + frameOverride);\n"
+	"	if (drawing.id === \"b\" && bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {\n"
+	"		bitsy.log(\"frame render: \" + drawing.type + \" \" + drawing.id + \" f:\" + frameOverride, bitsy.LOG_DEBUG, \"renderer\");\n"
 	"	}\n"
 	"\n"
 	"	if (!isDrawingRendered(drawing)) {\n"
-	"		bitsy.log(\"frame render: doesn't exist \" + drawing.id);\n"
+	"		if (bitsy.LOG_LEVEL >= bitsy.LOG_DEBUG) {\n"
+	"			bitsy.log(\"frame render: doesn't exist \" + drawing.id, bitsy.LOG_DEBUG, \"renderer\");\n"
+	"		}\n"
+	"\n"
 	"		renderDrawing(drawing);\n"
 	"	}\n"
 	"\n"
@@ -8044,6 +8290,7 @@ char* font_js =
 	"	}\n"
 	"\n"
 	"	this.getData = function() {\n"
+	"		unpackAllGlyphs();\n"
 	"		return chardata;\n"
 	"	}\n"
 	"\n"
@@ -8057,15 +8304,16 @@ char* font_js =
 	"\n"
 	"	this.hasChar = function(char) {\n"
 	"		var codepoint = char.charCodeAt(0);\n"
-	"		return chardata[codepoint] != null;\n"
+	"		return getCharData(codepoint) != null;\n"
 	"	}\n"
 	"\n"
 	"	this.getChar = function(char) {\n"
 	"\n"
 	"		var codepoint = char.charCodeAt(0);\n"
+	"		var charData = getCharData(codepoint);\n"
 	"\n"
-	"		if (chardata[codepoint] != null) {\n"
-	"			return chardata[codepoint];\n"
+	"		if (charData != null) {\n"
+	"			return charData;\n"
 	"		}\n"
 	"		else {\n"
 	"			return invalidCharData;\n"
@@ -8073,6 +8321,8 @@ char* font_js =
 	"	}\n"
 	"\n"
 	"	this.allCharCodes = function() {\n"
+	"		unpackAllGlyphs();\n"
+	"\n"
 	"		var codeList = [];\n"
 	"		for (var code in chardata) {\n"
 	"			codeList.push(code);\n"
@@ -8208,8 +8458,198 @@ char* font_js =
 	"		updateInvalidCharData();\n"
 	"	}\n"
 	"\n"
-	"	bitsy.log(\"parse font\");\n"
-	"	parseFont(fontData);\n"
+	"	/* GLYPH TABLES */\n"
+	"	// a glyph table is a prebaked binary version of a font\n"
+	"	// (so it can be loaded without parsing the text format) laid out like this:\n"
+	"	// \"BFNT\", version (1), width, height, name length, name,\n"
+	"	// glyph count (u32), glyph entries (16 bytes each, sorted by code point), glyph bitmaps\n"
+	"	// each glyph entry is: code point (u32), bitmap offset (u32), width, height, offset x (signed), offset y (signed), spacing, 3 unused bytes\n"
+	"	// and each glyph bitmap is 1 bit per pixel in row order (most significant bit first)\n"
+	"	// multi-byte values are little endian\n"
+	"	var glyphTableVersion = 1;\n"
+	"	var glyphEntrySize = 16;\n"
+	"\n"
+	"	var glyphTable = null;\n"
+	"	var glyphCount = 0;\n"
+	"	var glyphEntryStart = 0;\n"
+	"	var glyphBitmapStart = 0;\n"
+	"\n"
+	"	function isGlyphTable(fontData) {\n"
+	"		return fontData != null && typeof(fontData) != \"string\" && fontData.length >= 4\n"
+	"			&& fontData[0] === 66 && fontData[1] === 70 && fontData[2] === 78 && fontData[3] === 84; // \"BFNT\"\n"
+	"	}\n"
+	"\n"
+	"	function readUint32(bytes, i) {\n"
+	"		return (bytes[i] | (bytes[i + 1] << 8) | (bytes[i + 2] << 16) | (bytes[i + 3] << 24)) >>> 0;\n"
+	"	}\n"
+	"\n"
+	"	function readInt8(bytes, i) {\n"
+	"		return (bytes[i] << 24) >> 24;\n"
+	"	}\n"
+	"\n"
+	"	function loadGlyphTable(table) {\n"
+	"		if (table[4] != glyphTableVersion) {\n"
+	"			bitsy.log(\"unsupported glyph table version \" + table[4]);\n"
+	"			return;\n"
+	"		}\n"
+	"\n"
+	"		width = table[5];\n"
+	"		height = table[6];\n"
+	"\n"
+	"		var nameLength = table[7];\n"
+	"		name = \"\";\n"
+	"		for (var i = 0; i < nameLength; i++) {\n"
+	"			name += String.fromCharCode(table[8 + i]);\n"
+	"		}\n"
+	"\n"
+	"		glyphTable = table;\n"
+	"		glyphCount = readUint32(table, 8 + nameLength);\n"
+	"		glyphEntryStart = 8 + nameLength + 4;\n"
+	"		glyphBitmapStart = glyphEntryStart + (glyphCount * glyphEntrySize);\n"
+	"\n"
+	"		updateInvalidCharData();\n"
+	"	}\n"
+	"\n"
+	"	// binary search for the glyph's entry - returns -1 if the font doesn't have it\n"
+	"	function findGlyph(codepoint) {\n"
+	"		var lo = 0;\n"
+	"		var hi = glyphCount - 1;\n"
+	"\n"
+	"		while (lo <= hi) {\n"
+	"			var mid = (lo + hi) >> 1;\n"
+	"			var midCodepoint = readUint32(glyphTable, glyphEntryStart + (mid * glyphEntrySize));\n"
+	"\n"
+	"			if (midCodepoint === codepoint) {\n"
+	"				return mid;\n"
+	"			}\n"
+	"			else if (midCodepoint < codepoint) {\n"
+	"				lo = mid + 1;\n"
+	"			}\n"
+	"			else {\n"
+	"				hi = mid - 1;\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return -1;\n"
+	"	}\n"
+	"\n"
+	"	function unpackGlyph(glyphIndex) {\n"
+	"		var entry = glyphEntryStart + (glyphIndex * glyphEntrySize);\n"
+	"		var codepoint = readUint32(glyphTable, entry);\n"
+	"		var bitmap = glyphBitmapStart + readUint32(glyphTable, entry + 4);\n"
+	"\n"
+	"		var charData = createCharData();\n"
+	"		charData.width = glyphTable[entry + 8];\n"
+	"		charData.height = glyphTable[entry + 9];\n"
+	"		charData.offset.x = readInt8(glyphTable, entry + 10);\n"
+	"		charData.offset.y = readInt8(glyphTable, entry + 11);\n"
+	"		charData.spacing = glyphTable[entry + 12];\n"
+	"\n"
+	"		var pixelCount = charData.width * charData.height;\n"
+	"		for (var i = 0; i < pixelCount; i++) {\n"
+	"			charData.data.push((glyphTable[bitmap + (i >> 3)] >> (7 - (i & 7))) & 1);\n"
+	"		}\n"
+	"\n"
+	"		chardata[codepoint] = charData;\n"
+	"\n"
+	"		return charData;\n"
+	"	}\n"
+	"\n"
+	"	function unpackAllGlyphs() {\n"
+	"		if (glyphTable === null) {\n"
+	"			return;\n"
+	"		}\n"
+	"\n"
+	"		for (var i = 0; i < glyphCount; i++) {\n"
+	"			var codepoint = readUint32(glyphTable, glyphEntryStart + (i * glyphEntrySize));\n"
+	"			if (chardata[codepoint] === undefined) {\n"
+	"				unpackGlyph(i);\n"
+	"			}\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	// glyphs from a glyph table are only unpacked when they're first used\n"
+	"	function getCharData(codepoint) {\n"
+	"		if (chardata[codepoint] != null) {\n"
+	"			return chardata[codepoint];\n"
+	"		}\n"
+	"\n"
+	"		if (glyphTable != null) {\n"
+	"			var glyphIndex = findGlyph(codepoint);\n"
+	"			if (glyphIndex >= 0) {\n"
+	"				return unpackGlyph(glyphIndex);\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return null;\n"
+	"	}\n"
+	"\n"
+	"	this.createGlyphTable = function() {\n"
+	"		unpackAllGlyphs();\n"
+	"\n"
+	"		var codepoints = [];\n"
+	"		for (var code in chardata) {\n"
+	"			codepoints.push(parseInt(code));\n"
+	"		}\n"
+	"		codepoints.sort(function(a, b) { return a - b; });\n"
+	"\n"
+	"		var headerSize = 8 + name.length + 4;\n"
+	"		var bitmapSize = 0;\n"
+	"		for (var i = 0; i < codepoints.length; i++) {\n"
+	"			var charData = chardata[codepoints[i]];\n"
+	"			bitmapSize += Math.ceil((charData.width * charData.height) / 8);\n"
+	"		}\n"
+	"\n"
+	"		var table = new Uint8Array(headerSize + (codepoints.length * glyphEntrySize) + bitmapSize);\n"
+	"\n"
+	"		function writeUint32(i, value) {\n"
+	"			table[i] = value & 0xff;\n"
+	"			table[i + 1] = (value >> 8) & 0xff;\n"
+	"			table[i + 2] = (value >> 16) & 0xff;\n"
+	"			table[i + 3] = (value >> 24) & 0xff;\n"
+	"		}\n"
+	"\n"
+	"		table.set([66, 70, 78, 84, glyphTableVersion, width, height, name.length], 0);\n"
+	"		for (var i = 0; i < name.length; i++) {\n"
+	"			table[8 + i] = name.charCodeAt(i) & 0xff;\n"
+	"		}\n"
+	"		writeUint32(8 + name.length, codepoints.length);\n"
+	"\n"
+	"		var entry = headerSize;\n"
+	"		var bitmapStart = headerSize + (codepoints.length * glyphEntrySize);\n"
+	"		var bitmapOffset = 0;\n"
+	"		for (var i = 0; i < codepoints.length; i++) {\n"
+	"			var charData = chardata[codepoints[i]];\n"
+	"\n"
+	"			writeUint32(entry, codepoints[i]);\n"
+	"			writeUint32(entry + 4, bitmapOffset);\n"
+	"			table[entry + 8] = charData.width;\n"
+	"			table[entry + 9] = charData.height;\n"
+	"			table[entry + 10] = charData.offset.x & 0xff;\n"
+	"			table[entry + 11] = charData.offset.y & 0xff;\n"
+	"			table[entry + 12] = charData.spacing;\n"
+	"\n"
+	"			for (var j = 0; j < charData.data.length; j++) {\n"
+	"				if (charData.data[j] === 1) {\n"
+	"					table[bitmapStart + bitmapOffset + (j >> 3)] |= (1 << (7 - (j & 7)));\n"
+	"				}\n"
+	"			}\n"
+	"\n"
+	"			entry += glyphEntrySize;\n"
+	"			bitmapOffset += Math.ceil((charData.width * charData.height) / 8);\n"
+	"		}\n"
+	"\n"
+	"		return table;\n"
+	"	}\n"
+	"\n"
+	"	if (isGlyphTable(fontData)) {\n"
+	"		bitsy.log(\"load glyph table\");\n"
+	"		loadGlyphTable(fontData);\n"
+	"	}\n"
+	"	else {\n"
+	"		bitsy.log(\"parse font\");\n"
+	"		parseFont(fontData);\n"
+	"	}\n"
 	"\n"
 	"	bitsy.log(\"create font\");\n"
 	"}\n"
@@ -2309,4 +2309,362 @@ char* ascii_small_bitsyfont =
 	"000000\n"
 	"000000\n";
 
+unsigned int ascii_small_bitsyfont_glyphs_size = 5655;
+unsigned char ascii_small_bitsyfont_glyphs[] = {
+	0x42, 0x46, 0x4e, 0x54, 0x01, 0x06, 0x08, 0x0b, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5f, 0x73, 0x6d,
+	0x61, 0x6c, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x86, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xce, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x72, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xc6, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xd2, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xea, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xf6, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x6e, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x98, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xda, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xf2, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x2e, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x3a, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x46, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x4c, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x76, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x82, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x8e, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x9a, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xa6, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xac, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xb2, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xbe, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xd6, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xee, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x06,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x16, 0xd1,
+	0x55, 0x13, 0x80, 0x39, 0xf5, 0x5f, 0x45, 0xf3, 0x80, 0x00, 0xa7, 0xdf, 0x7c, 0xe1, 0x00, 0x00,
+	0x02, 0x8e, 0x38, 0x40, 0x00, 0x10, 0xe3, 0x84, 0x7d, 0xf1, 0x00, 0x00, 0x43, 0x9f, 0x7c, 0x43,
+	0x80, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0x00, 0x07, 0x92,
+	0x49, 0xe0, 0x00, 0xff, 0xf8, 0x6d, 0xb6, 0x1f, 0xff, 0x00, 0x70, 0xcd, 0x49, 0x23, 0x00, 0x39,
+	0x14, 0x4e, 0x10, 0xe1, 0x00, 0x10, 0x61, 0x44, 0x31, 0xc6, 0x00, 0x0c, 0xd2, 0xcd, 0x2d, 0xb6,
+	0x00, 0x01, 0x53, 0x9b, 0x39, 0x50, 0x00, 0x20, 0xc3, 0x8f, 0x38, 0xc2, 0x00, 0x08, 0x63, 0x9e,
+	0x38, 0x60, 0x80, 0x10, 0xe7, 0xc4, 0x7c, 0xe1, 0x00, 0x28, 0xa2, 0x8a, 0x28, 0x02, 0x80, 0x3d,
+	0x55, 0x4d, 0x14, 0x51, 0x40, 0x39, 0x13, 0x0a, 0x19, 0x13, 0x80, 0x00, 0x00, 0x00, 0x01, 0xe7,
+	0x80, 0x10, 0xe7, 0xc4, 0x7c, 0xe1, 0x0e, 0x10, 0xe7, 0xc4, 0x10, 0x41, 0x00, 0x10, 0x41, 0x04,
+	0x7c, 0xe1, 0x00, 0x00, 0x41, 0x9f, 0x18, 0x40, 0x00, 0x00, 0x43, 0x1f, 0x30, 0x40, 0x00, 0x00,
+	0x00, 0x10, 0x41, 0x07, 0xc0, 0x00, 0xa2, 0x9f, 0x28, 0xa0, 0x00, 0x10, 0x43, 0x8e, 0x7d, 0xf0,
+	0x00, 0x7d, 0xf3, 0x8e, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe3, 0x84,
+	0x10, 0x01, 0x00, 0x6d, 0xb4, 0x80, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xca, 0x29, 0xf2, 0x80, 0x20,
+	0xe4, 0x0c, 0x09, 0xc1, 0x00, 0x65, 0x90, 0x84, 0x21, 0x34, 0xc0, 0x21, 0x45, 0x08, 0x55, 0x23,
+	0x40, 0x30, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x08, 0x20, 0x81, 0x00, 0x20, 0x41, 0x04,
+	0x10, 0x42, 0x00, 0x00, 0xa3, 0x9f, 0x38, 0xa0, 0x00, 0x00, 0x41, 0x1f, 0x10, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc3, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+	0x00, 0x00, 0x10, 0x84, 0x21, 0x00, 0x00, 0x39, 0x14, 0xd5, 0x65, 0x13, 0x80, 0x10, 0xc1, 0x04,
+	0x10, 0x43, 0x80, 0x39, 0x10, 0x46, 0x21, 0x07, 0xc0, 0x39, 0x10, 0x4e, 0x05, 0x13, 0x80, 0x08,
+	0x62, 0x92, 0x7c, 0x20, 0x80, 0x7d, 0x04, 0x1e, 0x05, 0x13, 0x80, 0x18, 0x84, 0x1e, 0x45, 0x13,
+	0x80, 0x7c, 0x10, 0x84, 0x20, 0x82, 0x00, 0x39, 0x14, 0x4e, 0x45, 0x13, 0x80, 0x39, 0x14, 0x4f,
+	0x04, 0x23, 0x00, 0x00, 0x03, 0x0c, 0x00, 0xc3, 0x00, 0x00, 0x03, 0x0c, 0x00, 0xc3, 0x08, 0x08,
+	0x42, 0x10, 0x20, 0x40, 0x80, 0x00, 0x07, 0xc0, 0x01, 0xf0, 0x00, 0x20, 0x40, 0x81, 0x08, 0x42,
+	0x00, 0x39, 0x10, 0x46, 0x10, 0x01, 0x00, 0x39, 0x15, 0xd5, 0x5d, 0x03, 0x80, 0x39, 0x14, 0x51,
+	0x7d, 0x14, 0x40, 0x79, 0x14, 0x5e, 0x45, 0x17, 0x80, 0x39, 0x14, 0x10, 0x41, 0x13, 0x80, 0x79,
+	0x14, 0x51, 0x45, 0x17, 0x80, 0x7d, 0x04, 0x1e, 0x41, 0x07, 0xc0, 0x7d, 0x04, 0x1e, 0x41, 0x04,
+	0x00, 0x39, 0x14, 0x17, 0x45, 0x13, 0xc0, 0x45, 0x14, 0x5f, 0x45, 0x14, 0x40, 0x38, 0x41, 0x04,
+	0x10, 0x43, 0x80, 0x04, 0x10, 0x41, 0x45, 0x13, 0x80, 0x45, 0x25, 0x18, 0x51, 0x24, 0x40, 0x41,
+	0x04, 0x10, 0x41, 0x07, 0xc0, 0x45, 0xb5, 0x51, 0x45, 0x14, 0x40, 0x45, 0x95, 0x53, 0x45, 0x14,
+	0x40, 0x39, 0x14, 0x51, 0x45, 0x13, 0x80, 0x79, 0x14, 0x5e, 0x41, 0x04, 0x00, 0x39, 0x14, 0x51,
+	0x55, 0x23, 0x40, 0x79, 0x14, 0x5e, 0x49, 0x14, 0x40, 0x39, 0x14, 0x0e, 0x05, 0x13, 0x80, 0x7c,
+	0x41, 0x04, 0x10, 0x41, 0x00, 0x45, 0x14, 0x51, 0x45, 0x13, 0x80, 0x45, 0x14, 0x51, 0x44, 0xa1,
+	0x00, 0x45, 0x15, 0x55, 0x55, 0x52, 0x80, 0x45, 0x12, 0x84, 0x29, 0x14, 0x40, 0x45, 0x14, 0x4a,
+	0x10, 0x41, 0x00, 0x78, 0x21, 0x08, 0x41, 0x07, 0x80, 0x38, 0x82, 0x08, 0x20, 0x83, 0x80, 0x01,
+	0x02, 0x04, 0x08, 0x10, 0x00, 0x38, 0x20, 0x82, 0x08, 0x23, 0x80, 0x10, 0xa4, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81,
+	0x3d, 0x13, 0xc0, 0x41, 0x07, 0x91, 0x45, 0x17, 0x80, 0x00, 0x03, 0x91, 0x41, 0x13, 0x80, 0x04,
+	0x13, 0xd1, 0x45, 0x13, 0xc0, 0x00, 0x03, 0x91, 0x79, 0x03, 0x80, 0x18, 0x82, 0x1e, 0x20, 0x82,
+	0x00, 0x00, 0x03, 0xd1, 0x44, 0xf0, 0x4e, 0x41, 0x07, 0x12, 0x49, 0x24, 0x80, 0x10, 0x01, 0x04,
+	0x10, 0x41, 0x80, 0x08, 0x01, 0x82, 0x08, 0x24, 0x8c, 0x41, 0x04, 0x94, 0x61, 0x44, 0x80, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x80, 0x00, 0x06, 0x95, 0x55, 0x14, 0x40, 0x00, 0x07, 0x12, 0x49, 0x24,
+	0x80, 0x00, 0x03, 0x91, 0x45, 0x13, 0x80, 0x00, 0x07, 0x91, 0x45, 0x17, 0x90, 0x00, 0x03, 0xd1,
+	0x45, 0x13, 0xc1, 0x00, 0x05, 0x89, 0x20, 0x87, 0x00, 0x00, 0x03, 0x90, 0x38, 0x13, 0x80, 0x00,
+	0x87, 0x88, 0x20, 0xa1, 0x00, 0x00, 0x04, 0x92, 0x49, 0x62, 0x80, 0x00, 0x04, 0x51, 0x44, 0xa1,
+	0x00, 0x00, 0x04, 0x51, 0x55, 0xf2, 0x80, 0x00, 0x04, 0x92, 0x31, 0x24, 0x80, 0x00, 0x04, 0x92,
+	0x48, 0xe1, 0x18, 0x00, 0x07, 0x82, 0x31, 0x07, 0x80, 0x18, 0x82, 0x18, 0x20, 0x81, 0x80, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x30, 0x20, 0x83, 0x08, 0x23, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0xe6, 0xd1, 0x45, 0xf0, 0x00, 0x39, 0x14, 0x10, 0x44, 0xe1, 0x0c, 0x48, 0x04, 0x92,
+	0x49, 0x62, 0x80, 0x0c, 0x03, 0x91, 0x79, 0x03, 0x80, 0x38, 0x03, 0x81, 0x3d, 0x13, 0xc0, 0x28,
+	0x03, 0x81, 0x3d, 0x13, 0xc0, 0x30, 0x03, 0x81, 0x3d, 0x13, 0xc0, 0x38, 0xa3, 0x81, 0x3d, 0x13,
+	0xc0, 0x00, 0xe4, 0x50, 0x44, 0xe1, 0x0c, 0x38, 0x03, 0x91, 0x79, 0x03, 0x80, 0x28, 0x03, 0x91,
+	0x79, 0x03, 0x80, 0x30, 0x03, 0x91, 0x79, 0x03, 0x80, 0x28, 0x01, 0x04, 0x10, 0x41, 0x80, 0x10,
+	0xa0, 0x04, 0x10, 0x41, 0x80, 0x20, 0x01, 0x04, 0x10, 0x41, 0x80, 0x28, 0x01, 0x0a, 0x45, 0xf4,
+	0x40, 0x38, 0xa3, 0x9b, 0x45, 0xf4, 0x40, 0x0c, 0x07, 0xd0, 0x79, 0x07, 0xc0, 0x00, 0x07, 0x85,
+	0x7d, 0x43, 0xc0, 0x3d, 0x45, 0x1f, 0x51, 0x45, 0xc0, 0x38, 0x03, 0x12, 0x49, 0x23, 0x00, 0x28,
+	0x03, 0x12, 0x49, 0x23, 0x00, 0x60, 0x03, 0x12, 0x49, 0x23, 0x00, 0x38, 0x04, 0x92, 0x49, 0x62,
+	0x80, 0x60, 0x04, 0x92, 0x49, 0x62, 0x80, 0x28, 0x04, 0x92, 0x48, 0xe1, 0x18, 0x48, 0xc4, 0x92,
+	0x49, 0x23, 0x00, 0x28, 0x04, 0x92, 0x49, 0x23, 0x00, 0x00, 0x43, 0x90, 0x40, 0xe1, 0x00, 0x18,
+	0x92, 0x1e, 0x20, 0x95, 0xc0, 0x44, 0xa1, 0x1f, 0x11, 0xf1, 0x00, 0x61, 0x45, 0x1a, 0x5d, 0x24,
+	0x80, 0x08, 0x51, 0x0e, 0x10, 0x45, 0x08, 0x18, 0x03, 0x81, 0x3d, 0x13, 0xc0, 0x18, 0x01, 0x04,
+	0x10, 0x41, 0x80, 0x18, 0x03, 0x12, 0x49, 0x23, 0x00, 0x18, 0x04, 0x92, 0x49, 0x62, 0x80, 0x29,
+	0x40, 0x1c, 0x49, 0x24, 0x80, 0x29, 0x40, 0x12, 0x69, 0x64, 0x80, 0x38, 0x13, 0xd1, 0x3c, 0x03,
+	0xc0, 0x31, 0x24, 0x92, 0x30, 0x07, 0x80, 0x10, 0x01, 0x0c, 0x41, 0x13, 0x80, 0x00, 0x07, 0xd0,
+	0x41, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0x04, 0x00, 0x00, 0x41, 0x25, 0x0e, 0x44, 0x21, 0xc0, 0x41,
+	0x25, 0x0b, 0x54, 0x70, 0x40, 0x10, 0x01, 0x04, 0x38, 0xe1, 0x00, 0x00, 0x02, 0x52, 0x24, 0x00,
+	0x00, 0x00, 0x04, 0x89, 0x48, 0x00, 0x00, 0x54, 0x0a, 0x80, 0x54, 0x0a, 0x80, 0x56, 0xa5, 0x6a,
+	0x56, 0xa5, 0x6a, 0xab, 0xf5, 0x7f, 0xab, 0xf5, 0x7f, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x3c, 0x10, 0x41, 0x04, 0x00, 0x04, 0x92, 0x49, 0xc4, 0x10, 0x51, 0x45, 0x34, 0x51, 0x45,
+	0x14, 0x00, 0x00, 0x3c, 0x51, 0x45, 0x14, 0x03, 0xc1, 0x3c, 0x10, 0x41, 0x04, 0x53, 0x41, 0x34,
+	0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x03, 0xc1, 0x34, 0x51, 0x45, 0x14, 0x53,
+	0x41, 0x3c, 0x00, 0x00, 0x00, 0x51, 0x45, 0x3c, 0x00, 0x00, 0x00, 0x13, 0xc1, 0x3c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3c, 0x10, 0x41, 0x04, 0x10, 0x41, 0x07, 0x00, 0x00, 0x00, 0x10, 0x41, 0x3f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x41, 0x04, 0x10, 0x41, 0x07, 0x10, 0x41, 0x04, 0x00,
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x10, 0x41, 0x3f, 0x10, 0x41, 0x04, 0x10, 0x71, 0x07, 0x10, 0x41,
+	0x04, 0x51, 0x45, 0x17, 0x51, 0x45, 0x14, 0x51, 0x74, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x17,
+	0x51, 0x45, 0x14, 0x53, 0x70, 0x3f, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x37, 0x51, 0x45, 0x14, 0x51,
+	0x74, 0x17, 0x51, 0x45, 0x14, 0x03, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x53, 0x70, 0x37, 0x51, 0x45,
+	0x14, 0x13, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x51, 0x45, 0x3f, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x3f,
+	0x10, 0x41, 0x04, 0x00, 0x00, 0x3f, 0x51, 0x45, 0x14, 0x51, 0x45, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff,
+	0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xe3, 0x8e, 0x38, 0xe3, 0x8e,
+	0x38, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xfb, 0xef, 0xbe, 0xfb, 0xef, 0xbe, 0x01, 0xc4, 0x9c,
+	0x49, 0x27, 0x10, 0x79, 0x24, 0x10, 0x41, 0x04, 0x00, 0x01, 0xf2, 0x8a, 0x28, 0xa2, 0x80, 0x28,
+	0x03, 0x81, 0x3d, 0x13, 0xc0, 0x00, 0x03, 0xd2, 0x48, 0xc0, 0x00, 0x00, 0x04, 0x92, 0x49, 0xc4,
+	0x10, 0x00, 0x02, 0x94, 0x10, 0x41, 0x00, 0x38, 0x43, 0x91, 0x38, 0x43, 0x80, 0x31, 0x24, 0x9e,
+	0x49, 0x23, 0x00, 0x00, 0xe4, 0x51, 0x28, 0xa6, 0xc0, 0x31, 0x02, 0x04, 0x39, 0x23, 0x00, 0x00,
+	0x02, 0x95, 0x54, 0xa0, 0x00, 0x00, 0x43, 0x95, 0x54, 0xe1, 0x00, 0x00, 0xe4, 0x1e, 0x40, 0xe0,
+	0x00, 0x00, 0xc4, 0x92, 0x49, 0x20, 0x00, 0x01, 0xe0, 0x1e, 0x01, 0xe0, 0x00, 0x00, 0x43, 0x84,
+	0x00, 0xe0, 0x00, 0x40, 0xc0, 0x8c, 0x40, 0x07, 0x80, 0x00, 0x0f, 0xf8, 0x9a, 0x18, 0x3f, 0x00,
+	0x0f, 0xc7, 0x66, 0x10, 0x7f, 0x10, 0x41, 0x04, 0x11, 0x42, 0x00, 0x28, 0x03, 0x91, 0x45, 0x13,
+	0x80, 0xfb, 0xef, 0xbe, 0xfb, 0xef, 0xbe, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xe3, 0x8e, 0x38,
+	0xe3, 0x8e, 0x38, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x28,
+	0x04, 0x92, 0x49, 0x62, 0x80, 0x60, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xcb, 0x3f,
+	0x8f, 0x4b, 0xf4, 0x92, 0xfd, 0x20, 0x00
+};
+
 #endif
\ No newline at end of file
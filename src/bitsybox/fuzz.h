@@ -0,0 +1,29 @@
+#ifndef FUZZ_H
+#define FUZZ_H
+
+char* fuzz_js =
+	"// fuzz target for the game data loader (see the FUZZING section of main.c): the fuzz input is the\n"
+	"// game data, which goes through everything a game's data goes through when it's loaded and played\n"
+	"function __bitsybox_fuzz_world__() {\n"
+	"	var gameData = bitsy.getGameData();\n"
+	"	var world = parseWorld(gameData);\n"
+	"\n"
+	"	// normally fonts are only parsed, and scripts only compiled, once the game uses them\n"
+	"	for (var fontFilename in world.fonts) {\n"
+	"		fontManager.Create(world.fonts[fontFilename]);\n"
+	"	}\n"
+	"\n"
+	"	for (var id in world.dialog) {\n"
+	"		scriptInterpreter.Compile(\"fuzz_dialog_\" + id, world.dialog[id].src);\n"
+	"	}\n"
+	"\n"
+	"	for (var id in world.end) {\n"
+	"		scriptInterpreter.Compile(\"fuzz_end_\" + id, world.end[id].src);\n"
+	"	}\n"
+	"\n"
+	"	// then load it the way a game is loaded (skipping the title), which sets up its first room\n"
+	"	load_game(gameData, bitsy.getFontData(), false);\n"
+	"}\n"
+	"\n";
+
+#endif
\ No newline at end of file
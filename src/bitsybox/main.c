@@ -1,9 +1,12 @@
 #include <stdio.h>
+#include <stdarg.h>
 #include <math.h>
 #include <string.h>
-#include <unistd.h> // for getcwd, chdir
+#include <inttypes.h> // for PRIx64, PRIu32, SCNx64
+#include <unistd.h> // for getcwd, chdir, getpid
 #include <limits.h> // for PATH_MAX
 #include <dirent.h>
+#include <sys/stat.h> // for mkdir
 #include "duktape/duktape.h"
 #include "SDL.h"
 
@@ -14,6 +17,15 @@
 #include "font.h"
 #include "boot.h"
 #include "tune.h"
+#include "bench.h"
+#endif
+
+// the fuzz targets (see `make fuzz`) are built instead of the app
+#if defined(BUILD_FUZZ_WORLD) || defined(BUILD_FUZZ_API)
+#define BUILD_FUZZ
+#if !defined(BUILD_DEBUG)
+#include "fuzz.h"
+#endif
 #endif
 
 /* # TEST SETTINGS */
@@ -26,12 +38,20 @@
 
 int shouldContinue = 1;
 
+// modes that print their own reports (like `--bench`) turn the engine's logging off
+int isBitsyLogQuiet = 0;
+
 /* # SDL */
 
 SDL_Window* window;
 SDL_Event event;
 SDL_Renderer* renderer;
 
+// converts performance counter ticks to milliseconds
+double ticksToMs(Uint64 ticks) {
+	return (double) ticks * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
 /* # DUKTAPE */
 
 static void fatalError(void* udata, const char* msg) {
@@ -41,6 +61,511 @@ static void fatalError(void* udata, const char* msg) {
 	abort();
 }
 
+// heaps created with `createCountingHeap` count their allocations (for `--bench`) and the bytes they
+// hold (for the memory stats): every allocation starts with a header that remembers its size. the
+// counts live in the allocator's udata, so heaps on other threads (like `--validate` workers) keep their own
+typedef struct HeapStats {
+	uint64_t allocCount; // allocations and reallocations since the heap was created
+	uint64_t liveAllocCount;
+	uint64_t bytes;
+} HeapStats;
+
+typedef union HeapAllocHeader {
+	size_t size;
+	long double alignment; // so the allocation after the header is aligned like malloc's
+} HeapAllocHeader;
+
+static void* countingAlloc(void* udata, duk_size_t size) {
+	HeapStats* stats = (HeapStats*) udata;
+	HeapAllocHeader* header = malloc(sizeof(HeapAllocHeader) + size);
+
+	if (header == NULL) {
+		return NULL;
+	}
+
+	header->size = size;
+	stats->allocCount++;
+	stats->liveAllocCount++;
+	stats->bytes += size;
+
+	return header + 1;
+}
+
+static void countingFree(void* udata, void* ptr) {
+	HeapStats* stats = (HeapStats*) udata;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	HeapAllocHeader* header = ((HeapAllocHeader*) ptr) - 1;
+	stats->liveAllocCount--;
+	stats->bytes -= header->size;
+	free(header);
+}
+
+static void* countingRealloc(void* udata, void* ptr, duk_size_t size) {
+	HeapStats* stats = (HeapStats*) udata;
+
+	if (ptr == NULL) {
+		return countingAlloc(udata, size);
+	}
+
+	if (size == 0) {
+		countingFree(udata, ptr);
+		return NULL;
+	}
+
+	HeapAllocHeader* header = ((HeapAllocHeader*) ptr) - 1;
+	size_t prevSize = header->size;
+	header = realloc(header, sizeof(HeapAllocHeader) + size);
+
+	if (header == NULL) {
+		return NULL;
+	}
+
+	header->size = size;
+	stats->allocCount++;
+	stats->bytes = stats->bytes - prevSize + size;
+
+	return header + 1;
+}
+
+duk_context* createCountingHeap() {
+	HeapStats* stats = calloc(1, sizeof(HeapStats));
+
+	if (stats == NULL) {
+		fatalError(NULL, "out of memory");
+	}
+
+	return duk_create_heap(countingAlloc, countingRealloc, countingFree, stats, fatalError);
+}
+
+HeapStats* getHeapStats(duk_context* ctx) {
+	duk_memory_functions functions;
+	duk_get_memory_functions(ctx, &functions);
+
+	return (HeapStats*) functions.udata;
+}
+
+void destroyCountingHeap(duk_context* ctx) {
+	HeapStats* stats = getHeapStats(ctx);
+	duk_destroy_heap(ctx);
+	free(stats);
+}
+
+/* # TRACING */
+
+// with `--trace=FILE` bitsybox writes a timeline of what every thread is doing as trace-event JSON
+// (open it in https://ui.perfetto.dev or chrome://tracing): any thread can add events, and once
+// per frame the main thread swaps buffers and writes out the full one
+#define TRACE_EVENT_MAX 32768
+#define TRACE_DETAIL_MAX 64
+
+typedef struct TraceEvent {
+	char phase; // 'X' for a span, 'C' for a counter, 'M' to name a thread
+	const char* category;
+	const char* name;
+	SDL_threadID threadId;
+	Uint64 startTime;
+	Uint64 endTime;
+	double value; // counters only
+	char detail[TRACE_DETAIL_MAX]; // like the path of a loaded file
+} TraceEvent;
+
+char tracePath[PATH_MAX] = "";
+FILE* traceFile = NULL;
+int isTracing = 0;
+Uint64 traceStartTime = 0;
+
+TraceEvent* traceBuffers[2] = { NULL, NULL };
+int traceBufferCounts[2] = { 0, 0 };
+int traceBufferIndex = 0; // the buffer events are added to
+SDL_SpinLock traceLock = 0;
+uint64_t traceDropCount = 0; // events that didn't fit before the next flush
+int isTraceFileEmpty = 1;
+
+_Thread_local int isTraceThreadNamed = 0;
+
+void writeJsonString(FILE* f, const char* str) {
+	fputc('"', f);
+
+	for (const unsigned char* c = (const unsigned char*) str; *c != '\0'; c++) {
+		if (*c == '"' || *c == '\\') {
+			fprintf(f, "\\%c", *c);
+		}
+		else if (*c < 0x20) {
+			fprintf(f, "\\u%04x", *c);
+		}
+		else {
+			fputc(*c, f);
+		}
+	}
+
+	fputc('"', f);
+}
+
+void addTraceEvent(TraceEvent* event) {
+	event->threadId = SDL_ThreadID();
+
+	SDL_AtomicLock(&traceLock);
+
+	if (traceBufferCounts[traceBufferIndex] < TRACE_EVENT_MAX) {
+		traceBuffers[traceBufferIndex][traceBufferCounts[traceBufferIndex]++] = *event;
+	}
+	else {
+		traceDropCount++;
+	}
+
+	SDL_AtomicUnlock(&traceLock);
+}
+
+// adds a span from `startTime` to `endTime` (performance counter ticks)
+void traceSpan(const char* category, const char* name, Uint64 startTime, Uint64 endTime) {
+	if (!isTracing) {
+		return;
+	}
+
+	TraceEvent event = { .phase = 'X', .category = category, .name = name, .startTime = startTime, .endTime = endTime, };
+	addTraceEvent(&event);
+}
+
+void traceSpanDetail(const char* category, const char* name, Uint64 startTime, Uint64 endTime, const char* detail) {
+	if (!isTracing) {
+		return;
+	}
+
+	TraceEvent event = { .phase = 'X', .category = category, .name = name, .startTime = startTime, .endTime = endTime, };
+	// long paths are cut short on purpose, so the events (and the trace buffers) stay small
+	snprintf(event.detail, sizeof(event.detail), "%.*s", (int) sizeof(event.detail) - 1, detail);
+	addTraceEvent(&event);
+}
+
+void traceCounter(const char* name, double value) {
+	if (!isTracing) {
+		return;
+	}
+
+	TraceEvent event = { .phase = 'C', .name = name, .startTime = SDL_GetPerformanceCounter(), .value = value, };
+	addTraceEvent(&event);
+}
+
+// names the calling thread in the timeline (only the first call on each thread counts)
+void traceThreadName(const char* name) {
+	if (!isTracing || isTraceThreadNamed) {
+		return;
+	}
+
+	isTraceThreadNamed = 1;
+
+	TraceEvent event = { .phase = 'M', .name = name, };
+	addTraceEvent(&event);
+}
+
+double traceMicroseconds(Uint64 time) {
+	return (double) (time - traceStartTime) * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+void writeTraceEvent(FILE* f, TraceEvent* event) {
+	fprintf(f, isTraceFileEmpty ? "\n" : ",\n");
+	isTraceFileEmpty = 0;
+
+	if (event->phase == 'M') {
+		fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":", (unsigned long) event->threadId);
+		writeJsonString(f, event->name);
+		fprintf(f, "}}");
+	}
+	else if (event->phase == 'C') {
+		fprintf(f, "{\"name\":");
+		writeJsonString(f, event->name);
+		fprintf(
+			f,
+			",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%lu,\"args\":{\"value\":%.0f}}",
+			traceMicroseconds(event->startTime),
+			(unsigned long) event->threadId,
+			event->value);
+	}
+	else {
+		fprintf(f, "{\"name\":");
+		writeJsonString(f, event->name);
+		fprintf(f, ",\"cat\":");
+		writeJsonString(f, event->category);
+		fprintf(
+			f,
+			",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%lu",
+			traceMicroseconds(event->startTime),
+			traceMicroseconds(event->endTime) - traceMicroseconds(event->startTime),
+			(unsigned long) event->threadId);
+
+		if (event->detail[0] != '\0') {
+			fprintf(f, ",\"args\":{\"detail\":");
+			writeJsonString(f, event->detail);
+			fprintf(f, "}");
+		}
+
+		fprintf(f, "}");
+	}
+}
+
+// writes out the events added since the last flush (only call this from the main thread)
+void flushTrace() {
+	if (!isTracing) {
+		return;
+	}
+
+	SDL_AtomicLock(&traceLock);
+	int fullIndex = traceBufferIndex;
+	traceBufferIndex = 1 - traceBufferIndex;
+	SDL_AtomicUnlock(&traceLock);
+
+	for (int i = 0; i < traceBufferCounts[fullIndex]; i++) {
+		writeTraceEvent(traceFile, &traceBuffers[fullIndex][i]);
+	}
+
+	traceBufferCounts[fullIndex] = 0;
+}
+
+void startTrace() {
+	if (tracePath[0] == '\0') {
+		return;
+	}
+
+	traceFile = fopen(tracePath, "w");
+	traceBuffers[0] = malloc(sizeof(TraceEvent) * TRACE_EVENT_MAX);
+	traceBuffers[1] = malloc(sizeof(TraceEvent) * TRACE_EVENT_MAX);
+
+	if (traceFile == NULL || traceBuffers[0] == NULL || traceBuffers[1] == NULL) {
+		printf("Error writing %s\n", tracePath);
+		return;
+	}
+
+	fprintf(traceFile, "[");
+	traceStartTime = SDL_GetPerformanceCounter();
+	isTracing = 1;
+
+	traceThreadName("main");
+}
+
+void stopTrace() {
+	if (isTracing) {
+		// flush both buffers
+		flushTrace();
+		flushTrace();
+		isTracing = 0;
+
+		fprintf(traceFile, "\n]\n");
+
+		if (traceDropCount > 0) {
+			printf("The trace dropped %" PRIu64 " events (more than %d in a frame)\n", traceDropCount, TRACE_EVENT_MAX);
+		}
+	}
+
+	if (traceFile != NULL) {
+		fclose(traceFile);
+		traceFile = NULL;
+	}
+
+	free(traceBuffers[0]);
+	free(traceBuffers[1]);
+	traceBuffers[0] = NULL;
+	traceBuffers[1] = NULL;
+}
+
+/* # LOGGING */
+
+// log messages (like `bitsy.log`) go into a lock-free ring instead of straight to stdout, so a slow
+// console (like the pi's serial port) can't hold up a frame: they're written out in batches at the
+// end of a frame, at most every `LOG_FLUSH_MS`, or by a background thread (`--log-thread`)
+#define LOG_ERROR 0
+#define LOG_WARN 1
+#define LOG_INFO 2
+#define LOG_DEBUG 3
+#define LOG_TRACE 4
+#define LOG_LEVEL_COUNT 5
+
+#define LOG_RING_SIZE 1024 // must be a power of two
+#define LOG_MESSAGE_MAX 160
+#define LOG_CATEGORY_MAX 16
+#define LOG_FLUSH_MS 100
+
+const char* logLevelNames[LOG_LEVEL_COUNT] = { "error", "warn", "info", "debug", "trace" };
+
+typedef struct LogEntry {
+	SDL_atomic_t sequence; // which turn of the ring the entry is ready to be written (or read) on
+	int level;
+	char category[LOG_CATEGORY_MAX];
+	char message[LOG_MESSAGE_MAX];
+} LogEntry;
+
+LogEntry logRing[LOG_RING_SIZE];
+SDL_atomic_t logWriteIndex;
+int logReadIndex = 0; // only the thread that drains the log uses it
+SDL_atomic_t logDropCount;
+
+int logLevel = LOG_INFO; // messages above this level are skipped
+char logCategories[256] = ""; // comma separated (all categories when empty)
+int isLogThreadEnabled = 0;
+SDL_Thread* logThread = NULL;
+SDL_atomic_t isLogThreadStopping;
+Uint32 logPrevFlushTime = 0;
+
+void startLogger() {
+	for (int i = 0; i < LOG_RING_SIZE; i++) {
+		SDL_AtomicSet(&logRing[i].sequence, i);
+	}
+}
+
+int isLogCategoryEnabled(const char* category) {
+	if (logCategories[0] == '\0') {
+		return 1;
+	}
+
+	size_t length = strlen(category);
+
+	for (const char* c = logCategories; c != NULL && *c != '\0'; c = strchr(c, ',') ? strchr(c, ',') + 1 : NULL) {
+		if (strncmp(c, category, length) == 0 && (c[length] == ',' || c[length] == '\0')) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+// checked before a message is even formatted
+static inline int isLogged(int level, const char* category) {
+	return level <= logLevel && !isBitsyLogQuiet && isLogCategoryEnabled(category);
+}
+
+// adds a message to the ring (or drops it if the ring is full): safe to call from any thread
+void pushLogMessage(int level, const char* category, const char* message) {
+	while (1) {
+		int index = SDL_AtomicGet(&logWriteIndex);
+		LogEntry* entry = &logRing[index & (LOG_RING_SIZE - 1)];
+		int turn = SDL_AtomicGet(&entry->sequence) - index;
+
+		if (turn < 0) {
+			// the entry hasn't been read since the last time around
+			SDL_AtomicAdd(&logDropCount, 1);
+			return;
+		}
+
+		if (turn == 0 && SDL_AtomicCAS(&logWriteIndex, index, index + 1)) {
+			entry->level = level;
+			snprintf(entry->category, sizeof(entry->category), "%s", category);
+			snprintf(entry->message, sizeof(entry->message), "%s", message);
+			SDL_AtomicSet(&entry->sequence, index + 1);
+			return;
+		}
+
+		// another thread took this entry: try the next one
+	}
+}
+
+void logMessage(int level, const char* category, const char* format, ...) {
+	if (!isLogged(level, category)) {
+		return;
+	}
+
+	char message[LOG_MESSAGE_MAX];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(message, sizeof(message), format, args);
+	va_end(args);
+
+	pushLogMessage(level, category, message);
+}
+
+// writes out everything in the ring with one write (only one thread at a time can drain it)
+void drainLog() {
+	static char buffer[LOG_RING_SIZE * 64];
+	size_t length = 0;
+
+	while (1) {
+		LogEntry* entry = &logRing[logReadIndex & (LOG_RING_SIZE - 1)];
+
+		if (SDL_AtomicGet(&entry->sequence) != logReadIndex + 1) {
+			// nothing more has been written
+			break;
+		}
+
+		char line[LOG_CATEGORY_MAX + LOG_MESSAGE_MAX + 16];
+		int lineLength = snprintf(line, sizeof(line), "%s::%s\n", entry->category, entry->message);
+
+		if (lineLength >= (int) sizeof(line)) {
+			lineLength = sizeof(line) - 1;
+		}
+
+		if (length + lineLength > sizeof(buffer)) {
+			fwrite(buffer, 1, length, stdout);
+			length = 0;
+		}
+
+		memcpy(&buffer[length], line, lineLength);
+		length += lineLength;
+
+		// hand the entry back to the writers for the next time around
+		SDL_AtomicSet(&entry->sequence, logReadIndex + LOG_RING_SIZE);
+		logReadIndex++;
+	}
+
+	int dropCount = SDL_AtomicSet(&logDropCount, 0);
+
+	if (length > 0 || dropCount > 0) {
+		fwrite(buffer, 1, length, stdout);
+
+		if (dropCount > 0) {
+			printf("[%d log messages dropped]\n", dropCount);
+		}
+
+		fflush(stdout);
+	}
+}
+
+// called at the end of every frame (unless the log thread is running)
+void updateLog() {
+	if (logThread != NULL) {
+		return;
+	}
+
+	Uint32 time = SDL_GetTicks();
+	int pendingCount = SDL_AtomicGet(&logWriteIndex) - logReadIndex;
+
+	// write out at most every `LOG_FLUSH_MS`, unless the ring is filling up
+	if ((time - logPrevFlushTime) >= LOG_FLUSH_MS || pendingCount >= LOG_RING_SIZE / 2) {
+		drainLog();
+		logPrevFlushTime = time;
+	}
+}
+
+int logThreadMain(void* data) {
+	while (!SDL_AtomicGet(&isLogThreadStopping)) {
+		drainLog();
+		SDL_Delay(LOG_FLUSH_MS);
+	}
+
+	return 0;
+}
+
+void startLogThread() {
+	logThread = SDL_CreateThread(logThreadMain, "bitsybox log", NULL);
+
+	if (logThread == NULL) {
+		printf("Couldn't start the log thread: %s\n", SDL_GetError());
+		isLogThreadEnabled = 0;
+	}
+}
+
+// writes out whatever is left (and stops the log thread)
+void stopLogger() {
+	if (logThread != NULL) {
+		SDL_AtomicSet(&isLogThreadStopping, 1);
+		SDL_WaitThread(logThread, NULL);
+		logThread = NULL;
+	}
+
+	drainLog();
+}
+
 /* # WINDOW */
 
 #if defined(PLATFORM_RPI) && !defined(BUILD_DEBUG)
@@ -58,7 +583,7 @@ void onWindowResize() {
 	SDL_GetWindowSize(window, &windowWidth, &windowHeight);
 }
 
-/* # MEMORY */
+/* # SYSTEM STATE */
 
 typedef struct MemoryBlock {
 	uint32_t size;
@@ -66,15 +591,69 @@ typedef struct MemoryBlock {
 } MemoryBlock;
 
 #define MEMORY_BLOCK_MAX 1024
-MemoryBlock memory[MEMORY_BLOCK_MAX];
+
+typedef struct Color {
+	int r;
+	int g;
+	int b;
+} Color;
+
+#define PALETTE_MAX 256
+
+// everything the bitsy system API changes as a program runs
+typedef struct SystemState {
+	MemoryBlock memory[MEMORY_BLOCK_MAX];
+	Color palette[PALETTE_MAX];
+
+	// graphics modes
+	int graphicsMode;
+	int textMode;
+
+	int textboxRenderScale;
+
+	// should SDL textures be re-rendered this frame?
+	int shouldRenderTextures;
+
+	// textbox state
+	int isTextboxVisible;
+	int textboxX;
+	int textboxY;
+	int textboxWidth;
+	int textboxHeight;
+
+	// for `Math.random`
+	uint64_t randomState;
+
+	// programs that run without the audio device (like `--validate` workers) have their sound dropped
+	int isAudioMuted;
+
+	// and programs that run without input press the bitsy buttons here (one bit per button code)
+	int isInputScripted;
+	uint32_t scriptedButtons;
+
+	// live tiles, and calls to `bitsy.tile` and `bitsy.delete` (for the memory stats)
+	int tileCount;
+	uint64_t tileCreateCount;
+	uint64_t tileDeleteCount;
+} SystemState;
+
+SystemState bitsyboxSystem = {
+	.textboxRenderScale = 2,
+};
+
+// the state that the system API works with on this thread: it's bitsybox's own (shared with the
+// update thread), except on `--validate` worker threads, which each run programs with their own
+_Thread_local SystemState* curSystem = &bitsyboxSystem;
+
+/* # MEMORY */
 
 void freeMemoryBlock(int block) {
-	if (memory[block].data != NULL) {
-		free(memory[block].data);
+	if (curSystem->memory[block].data != NULL) {
+		free(curSystem->memory[block].data);
 	}
 
-	memory[block].size = -1;
-	memory[block].data = NULL;
+	curSystem->memory[block].size = -1;
+	curSystem->memory[block].data = NULL;
 }
 
 void initializeMemoryBlocks() {
@@ -83,16 +662,16 @@ void initializeMemoryBlocks() {
 	}
 }
 
-void allocateMemoryBlock(int block, uint16_t size) {
+void allocateMemoryBlock(int block, uint32_t size) {
 	// free any existing memory before re-allocating it!
 	freeMemoryBlock(block);
 
-	memory[block].size = size;
-	memory[block].data = calloc(size, sizeof(uint8_t));
+	curSystem->memory[block].size = size;
+	curSystem->memory[block].data = calloc(size, sizeof(uint8_t));
 }
 
 int isMemoryBlockEmpty(int block) {
-	return memory[block].size <= 0 || memory[block].data == NULL;
+	return curSystem->memory[block].size <= 0 || curSystem->memory[block].data == NULL;
 }
 
 int isMemoryBlockValid(int block) {
@@ -101,35 +680,106 @@ int isMemoryBlockValid(int block) {
 
 /* # GRAPHICS */
 
-typedef struct Color {
-	int r;
-	int g;
-	int b;
-} Color;
-
-#define PALETTE_MAX 256
-Color systemPalette[PALETTE_MAX];
-
 #define TEXTURE_MAX MEMORY_BLOCK_MAX
 SDL_Texture* textures[TEXTURE_MAX];
 
-// graphics modes
-int curGraphicsMode;
-int curTextMode;
-
-// render scales
+// render scale (the textbox's is part of the system state)
 int renderScale = 4;
-int textboxRenderScale = 2;
 
-// should SDL textures be re-rendered this frame?
-int shouldRenderTextures = 0;
+// size of the textbox texture (in pixels), which is recreated when the textbox changes size
+int textboxTextureWidth = 0;
+int textboxTextureHeight = 0;
+
+// everything the renderer reads to draw a frame: the renderer only ever looks at a snapshot,
+// so the engine can go on to the next update (on another thread) while the frame is drawn
+typedef struct FrameSnapshot {
+	MemoryBlock memory[MEMORY_BLOCK_MAX]; // either the engine's own blocks, or the copies below
+	MemoryBlock copies[MEMORY_BLOCK_MAX]; // (the size of a copy is its capacity)
+	Color palette[PALETTE_MAX];
+	int graphicsMode;
+	int textboxRenderScale;
+	int isTextboxVisible;
+	int textboxX;
+	int textboxY;
+	int textboxWidth;
+	int textboxHeight;
+	int shouldRenderTextures;
+	Uint64 captureTime; // performance counter
+} FrameSnapshot;
+
+// takes the engine's current graphics state (copying the memory if it's going to keep changing)
+void captureFrame(FrameSnapshot* frame, int shouldCopyMemory) {
+	for (int i = 0; i < MEMORY_BLOCK_MAX; i++) {
+		if (!shouldCopyMemory || isMemoryBlockEmpty(i)) {
+			frame->memory[i] = curSystem->memory[i];
+			continue;
+		}
+
+		MemoryBlock* copy = &frame->copies[i];
+		if (copy->data == NULL || copy->size < curSystem->memory[i].size) {
+			free(copy->data);
+			copy->size = curSystem->memory[i].size;
+			copy->data = malloc(copy->size);
+		}
+
+		memcpy(copy->data, curSystem->memory[i].data, curSystem->memory[i].size);
+		frame->memory[i].size = curSystem->memory[i].size;
+		frame->memory[i].data = copy->data;
+	}
+
+	memcpy(frame->palette, curSystem->palette, sizeof(frame->palette));
+	frame->graphicsMode = curSystem->graphicsMode;
+	frame->textboxRenderScale = curSystem->textboxRenderScale;
+	frame->isTextboxVisible = curSystem->isTextboxVisible;
+	frame->textboxX = curSystem->textboxX;
+	frame->textboxY = curSystem->textboxY;
+	frame->textboxWidth = curSystem->textboxWidth;
+	frame->textboxHeight = curSystem->textboxHeight;
+
+	// changes made since the last capture are drawn with this frame
+	frame->shouldRenderTextures = curSystem->shouldRenderTextures;
+	curSystem->shouldRenderTextures = 0;
+
+	frame->captureTime = SDL_GetPerformanceCounter();
+}
+
+int isFrameBlockEmpty(FrameSnapshot* frame, int block) {
+	return frame->memory[block].size <= 0 || frame->memory[block].data == NULL;
+}
+
+// for the memory stats (updated on the main thread, but read by the engine too)
+SDL_atomic_t textureCount;
+SDL_atomic_t textureBytes; // estimated from each texture's size and format
+
+int estimateTextureBytes(SDL_Texture* texture) {
+	Uint32 format = 0;
+	int width = 0;
+	int height = 0;
+	SDL_QueryTexture(texture, &format, NULL, &width, &height);
+
+	return width * height * SDL_BYTESPERPIXEL(format);
+}
+
+SDL_Texture* createTexture(Uint32 format, int width, int height) {
+	SDL_Texture* texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, width, height);
+
+	if (texture != NULL) {
+		SDL_AtomicAdd(&textureCount, 1);
+		SDL_AtomicAdd(&textureBytes, estimateTextureBytes(texture));
+	}
+
+	return texture;
+}
+
+void destroyTexture(int index) {
+	if (textures[index] != NULL) {
+		SDL_AtomicAdd(&textureCount, -1);
+		SDL_AtomicAdd(&textureBytes, -estimateTextureBytes(textures[index]));
 
-// textbox state
-int isTextboxVisible = 0;
-int textboxX = 0;
-int textboxY = 0;
-int textboxWidth = 0;
-int textboxHeight = 0;
+		SDL_DestroyTexture(textures[index]);
+		textures[index] = NULL;
+	}
+}
 
 /* # INPUT */
 
@@ -167,1605 +817,5750 @@ int mouseX = 0;
 int mouseY = 0;
 int isLeftMouseDown = 0;
 
-/* # AUDIO */
-
-// samples per second
-#define AUDIO_SAMPLE_RATE 44100
-// size of the audio buffer in samples (filled by audio callback)
-#define AUDIO_BUFFER_SIZE 256
+// maps an SDL keycode or controller button to one of the button states above
+typedef struct ButtonBinding {
+	int code;
+	int* state;
+	int wasPressedThisFrame;
+	int isReleasePending; // released in the same frame it was pressed, so the release waits a frame
+} ButtonBinding;
+
+ButtonBinding keyBindings[] = {
+	{ SDLK_UP, &isButtonUp },
+	{ SDLK_DOWN, &isButtonDown },
+	{ SDLK_LEFT, &isButtonLeft },
+	{ SDLK_RIGHT, &isButtonRight },
+	{ SDLK_w, &isButtonW },
+	{ SDLK_a, &isButtonA },
+	{ SDLK_s, &isButtonS },
+	{ SDLK_d, &isButtonD },
+	{ SDLK_r, &isButtonR },
+	{ SDLK_SPACE, &isButtonSpace },
+	{ SDLK_RETURN, &isButtonReturn },
+	{ SDLK_ESCAPE, &isButtonEscape },
+	{ SDLK_LCTRL, &isButtonLCtrl },
+	{ SDLK_RCTRL, &isButtonRCtrl },
+	{ SDLK_LALT, &isButtonLAlt },
+	{ SDLK_RALT, &isButtonRAlt },
+};
+
+ButtonBinding padBindings[] = {
+	{ SDL_CONTROLLER_BUTTON_DPAD_UP, &isButtonPadUp },
+	{ SDL_CONTROLLER_BUTTON_DPAD_DOWN, &isButtonPadDown },
+	{ SDL_CONTROLLER_BUTTON_DPAD_LEFT, &isButtonPadLeft },
+	{ SDL_CONTROLLER_BUTTON_DPAD_RIGHT, &isButtonPadRight },
+	{ SDL_CONTROLLER_BUTTON_A, &isButtonPadA },
+	{ SDL_CONTROLLER_BUTTON_B, &isButtonPadB },
+	{ SDL_CONTROLLER_BUTTON_X, &isButtonPadX },
+	{ SDL_CONTROLLER_BUTTON_Y, &isButtonPadY },
+	{ SDL_CONTROLLER_BUTTON_START, &isButtonPadStart },
+};
+
+#define KEY_BINDING_COUNT (int) (sizeof(keyBindings) / sizeof(ButtonBinding))
+#define PAD_BINDING_COUNT (int) (sizeof(padBindings) / sizeof(ButtonBinding))
+
+/* # INPUT RECORDING */
+
+// `--record` saves the button state and number of updates of every frame so that `--replay` can
+// feed the exact same session back through the engine. the file is a header ("BBXR", a version
+// byte, and the 32-bit random seed) followed by one byte per frame: the update count, with the
+// high bit set when a new 32-bit button state follows (all values are little endian). a frame
+// byte of `INPUT_RECORD_PROGRAM` marks the start of a program (the boot menu, a game, etc) instead:
+// it's followed by the program, the 64-bit random state and the 32-bit button state at that point,
+// so `--headless` can skip straight to the game
+#define INPUT_RECORD_VERSION 2
+#define INPUT_RECORD_CHANGED 0x80
+#define INPUT_RECORD_PROGRAM 0x7F
+
+#define INPUT_PROGRAM_BOOT 0
+#define INPUT_PROGRAM_GAME 1
+#define INPUT_PROGRAM_TUNE_TOOL 2
+#define INPUT_PROGRAM_DEMO 3
+
+char inputRecordPath[PATH_MAX] = "";
+char inputReplayPath[PATH_MAX] = "";
+FILE* inputRecordFile = NULL;
+FILE* inputReplayFile = NULL;
+uint32_t inputRecordButtons = 0; // the last button state written or read
+int inputReplayFrameCount = 0;
+int isInputReplayOneProgram = 0; // stop the replay at the next program marker (for `--headless`)
+
+// seed for `Math.random` (recorded so replays make the same choices)
+uint32_t randomSeed = 0;
+int isRandomSeedSet = 0;
+
+// one bit per key and controller button binding
+uint32_t getButtonStates() {
+	uint32_t buttons = 0;
+
+	for (int i = 0; i < KEY_BINDING_COUNT; i++) {
+		buttons |= (*keyBindings[i].state ? 1u : 0u) << i;
+	}
 
-int audioStep = 0; // global audio step counter for sampling
-float audioVolume = 0.0f; // global audio volume (range: 0.0 - 1.0)
+	for (int i = 0; i < PAD_BINDING_COUNT; i++) {
+		buttons |= (*padBindings[i].state ? 1u : 0u) << (KEY_BINDING_COUNT + i);
+	}
 
-typedef struct PulseWave {
-	int cycle; // cycle length in sample steps
-	int duty; // duty length in sample steps
-} PulseWave;
-
-PulseWave wave(float frequency, float dutyCycle) {
-	// calculate cycle length in samples
-	float cycle = AUDIO_SAMPLE_RATE / frequency;
-	// calcualte duty lenght in samples
-	float duty = cycle * dutyCycle;
-
-	// convert cycle and duty to integer steps
-	return (PulseWave) {
-		.cycle = floor(cycle),
-		.duty = floor(duty),
-	};
+	return buttons;
 }
 
-int pulse(PulseWave* wave, int step) {
-	return (step % wave->cycle) <= wave->duty ? 1 : 0;	
-}
+void setButtonStates(uint32_t buttons) {
+	for (int i = 0; i < KEY_BINDING_COUNT; i++) {
+		*keyBindings[i].state = (buttons >> i) & 1;
+	}
 
-// sound channels
-PulseWave soundChannel1;
-float volumeChannel1 = 0.0f; // volume from 0.0 - 1.0
-int durationChannel1 = 0; // duration in *samples* (not frames or ms)
-int dutyChannel1;
+	for (int i = 0; i < PAD_BINDING_COUNT; i++) {
+		*padBindings[i].state = (buttons >> (KEY_BINDING_COUNT + i)) & 1;
+	}
+}
 
-PulseWave soundChannel2;
-float volumeChannel2 = 0.0f; // volume from 0.0 - 1.0
-int durationChannel2 = 0; // duration in *samples* (not frames or ms)
-int dutyChannel2;
+void writeLittleEndian(FILE* f, uint32_t value, int byteCount) {
+	for (int i = 0; i < byteCount; i++) {
+		fputc((value >> (i * 8)) & 0xFF, f);
+	}
+}
 
-void audioCallback(void* userdata, Uint8* stream, int len) {
-	float* fstream = (float*) stream;
+int readLittleEndian(FILE* f, uint32_t* value, int byteCount) {
+	*value = 0;
 
-	for (int i = 0; i < AUDIO_BUFFER_SIZE; i++) {
-		// increment global audio step
-		audioStep++;
+	for (int i = 0; i < byteCount; i++) {
+		int c = fgetc(f);
 
-		// decrement channel duration counters and mute audio when they reach zero
-		durationChannel1--;
-		if (durationChannel1 <= 0) {
-			volumeChannel1 = 0.0f;
-			durationChannel1 = 0;
+		if (c == EOF) {
+			return 0;
 		}
 
-		durationChannel2--;
-		if (durationChannel2 <= 0) {
-			volumeChannel2 = 0.0f;
-			durationChannel2 = 0;
-		}
+		*value |= ((uint32_t) c) << (i * 8);
+	}
+
+	return 1;
+}
 
-		// calculate pulse wave sample for channel 1
-		fstream[(i * 2) + 0] = pulse(&soundChannel1, audioStep) * volumeChannel1 * audioVolume;
+int startInputRecording() {
+	inputRecordFile = fopen(inputRecordPath, "wb");
 
-		// calculate pulse wave sample for channel 2
-		fstream[(i * 2) + 1] = pulse(&soundChannel2, audioStep) * volumeChannel2 * audioVolume;
+	if (inputRecordFile == NULL) {
+		printf("Error writing %s\n", inputRecordPath);
+		return 0;
 	}
+
+	fwrite("BBXR", 1, 4, inputRecordFile);
+	fputc(INPUT_RECORD_VERSION, inputRecordFile);
+	writeLittleEndian(inputRecordFile, randomSeed, 4);
+
+	return 1;
 }
 
-/* # FILE LOADING */
+int startInputReplay() {
+	inputReplayFile = fopen(inputReplayPath, "rb");
 
-char gameFilePath[256];
-int gameCount = 0;
+	if (inputReplayFile == NULL) {
+		printf("Error reading %s\n", inputReplayPath);
+		return 0;
+	}
 
-int loadScript(duk_context* ctx, char* filepath) {
-	int success = 0;
+	char magic[4];
+	if (fread(magic, 1, 4, inputReplayFile) != 4 || memcmp(magic, "BBXR", 4) != 0 || fgetc(inputReplayFile) != INPUT_RECORD_VERSION) {
+		printf("%s isn't a bitsybox recording\n", inputReplayPath);
+		fclose(inputReplayFile);
+		inputReplayFile = NULL;
+		return 0;
+	}
 
-	printf("Loading %s ...\n", filepath);
+	readLittleEndian(inputReplayFile, &randomSeed, 4);
+	isRandomSeedSet = 1;
 
-	char* fileBuffer = 0;
-	long length;
-	FILE* f = fopen(filepath, "r");
+	return 1;
+}
 
-	if (f) {
-		fseek(f, 0, SEEK_END);
+void recordInputFrame(int updateCount) {
+	uint32_t buttons = getButtonStates();
+	int isChanged = buttons != inputRecordButtons;
 
-		length = ftell(f);
+	fputc(updateCount | (isChanged ? INPUT_RECORD_CHANGED : 0), inputRecordFile);
 
-		fseek(f, 0, SEEK_SET);
+	if (isChanged) {
+		writeLittleEndian(inputRecordFile, buttons, 4);
+		inputRecordButtons = buttons;
+	}
+}
 
-		// length +1 to make sure there's room for null terminator
-		fileBuffer = malloc(length + 1);
+void recordInputProgram(int program) {
+	if (inputRecordFile == NULL) {
+		return;
+	}
 
-		if (fileBuffer) {
-			// replace seek length with read length
-			length = fread(fileBuffer, 1, length, f);
+	inputRecordButtons = getButtonStates();
 
-			// ensure null terminator
-			fileBuffer[length] = '\0';
-		}
+	fputc(INPUT_RECORD_PROGRAM, inputRecordFile);
+	fputc(program, inputRecordFile);
+	writeLittleEndian(inputRecordFile, (uint32_t) curSystem->randomState, 4);
+	writeLittleEndian(inputRecordFile, (uint32_t) (curSystem->randomState >> 32), 4);
+	writeLittleEndian(inputRecordFile, inputRecordButtons, 4);
+}
 
-		fclose(f);
+// reads the rest of a program marker, and picks up the random state from it
+int readInputProgram(int* program) {
+	*program = fgetc(inputReplayFile);
+	uint32_t randomLow = 0;
+	uint32_t randomHigh = 0;
+
+	if (*program == EOF
+		|| !readLittleEndian(inputReplayFile, &randomLow, 4)
+		|| !readLittleEndian(inputReplayFile, &randomHigh, 4)
+		|| !readLittleEndian(inputReplayFile, &inputRecordButtons, 4)) {
+		return 0;
 	}
 
-	if (fileBuffer) {
-		duk_push_lstring(ctx, (const char *) fileBuffer, (duk_size_t) length);
+	curSystem->randomState = ((uint64_t) randomHigh << 32) | randomLow;
 
-		if (duk_peval(ctx) != 0) {
-			printf("Load Script Error: %s\n", duk_safe_to_string(ctx, -1));
+	return 1;
+}
+
+// skips the recording ahead to the start of the first `program` (returns 0 if there isn't one)
+int skipToInputProgram(int program) {
+	while (1) {
+		int frame = fgetc(inputReplayFile);
+		int frameProgram = -1;
+
+		if (frame == EOF) {
+			return 0;
 		}
-		else {
-			success = 1;
+		else if (frame == INPUT_RECORD_PROGRAM) {
+			if (!readInputProgram(&frameProgram)) {
+				return 0;
+			}
+			else if (frameProgram == program) {
+				return 1;
+			}
 		}
+		else if ((frame & INPUT_RECORD_CHANGED) && !readLittleEndian(inputReplayFile, &inputRecordButtons, 4)) {
+			return 0;
+		}
+	}
+}
 
-		duk_pop(ctx);
+// replaces the live input with the next recorded frame (returns 0 once the recording runs out)
+int replayInputFrame(int* updateCount) {
+	int frame = fgetc(inputReplayFile);
+	int program = 0;
+
+	while (frame == INPUT_RECORD_PROGRAM) {
+		if (isInputReplayOneProgram || !readInputProgram(&program)) {
+			return 0;
+		}
+
+		frame = fgetc(inputReplayFile);
 	}
 
-	return success;
+	if (frame == EOF || ((frame & INPUT_RECORD_CHANGED) && !readLittleEndian(inputReplayFile, &inputRecordButtons, 4))) {
+		return 0;
+	}
+
+	*updateCount = frame & ~INPUT_RECORD_CHANGED;
+	setButtonStates(inputRecordButtons);
+	inputReplayFrameCount++;
+
+	return 1;
 }
 
-int loadFile(duk_context* ctx, char* filepath, char* variableName) {
-	int success = 0;
+void stopInputRecording() {
+	if (inputRecordFile != NULL) {
+		fclose(inputRecordFile);
+		inputRecordFile = NULL;
+	}
 
-	printf("Loading %s ...\n", filepath);
+	if (inputReplayFile != NULL) {
+		printf("Replayed %d frames from %s\n", inputReplayFrameCount, inputReplayPath);
+		fclose(inputReplayFile);
+		inputReplayFile = NULL;
+	}
+}
 
-	char* fileBuffer = 0;
-	long length;
-	FILE* f = fopen(filepath, "r");
+/* # INPUT LATENCY */
+
+// with `--input-latency`, each button press is followed from the moment SDL hands us the event,
+// to the first `bitsy.button` call that sees a button down, to the first write to visible memory
+// after that, to the first `SDL_RenderPresent` that shows it (one press is followed at a time)
+#define LATENCY_BUCKET_COUNT 100 // one millisecond per bucket (the last one counts anything longer)
+#define LATENCY_FRAME_MAX 16 // presses that don't change the screen within this many frames are dropped
+
+#define LATENCY_STAGE_IDLE 0
+#define LATENCY_STAGE_DELIVERED 1
+#define LATENCY_STAGE_READ 2
+#define LATENCY_STAGE_WRITTEN 3
+
+typedef struct LatencyHistogram {
+	int counts[LATENCY_BUCKET_COUNT];
+	int total;
+	double sum; // in milliseconds
+	double max;
+} LatencyHistogram;
+
+int isInputLatencyEnabled = 0;
+SDL_atomic_t inputLatencyStage; // moved forward by the main thread and the update thread
+Uint64 inputLatencyTimes[4]; // performance counter time at each stage
+int inputLatencyFrames = 0; // frames presented since the press was delivered
+int inputLatencyDropCount = 0;
+
+LatencyHistogram inputReadLatency; // delivered -> read by the engine
+LatencyHistogram inputWriteLatency; // delivered -> first visible memory write
+LatencyHistogram inputPresentLatency; // delivered -> on screen
+int inputPresentFrameCounts[LATENCY_FRAME_MAX + 1];
+
+void addLatencySample(LatencyHistogram* histogram, Uint64 startTime, Uint64 endTime) {
+	double ms = (double) (endTime - startTime) * 1000.0 / SDL_GetPerformanceFrequency();
+	int bucket = (int) ms;
+
+	histogram->counts[bucket < LATENCY_BUCKET_COUNT ? bucket : (LATENCY_BUCKET_COUNT - 1)]++;
+	histogram->total++;
+	histogram->sum += ms;
+	histogram->max = ms > histogram->max ? ms : histogram->max;
+}
 
-	if (f) {
-		fseek(f, 0, SEEK_END);
+void advanceInputLatency(int fromStage, int toStage) {
+	// only one thread moves the press out of each stage, so it's safe to set the time first
+	if (isInputLatencyEnabled && SDL_AtomicGet(&inputLatencyStage) == fromStage) {
+		inputLatencyTimes[toStage] = SDL_GetPerformanceCounter();
+		SDL_AtomicCAS(&inputLatencyStage, fromStage, toStage);
+	}
+}
 
-		length = ftell(f);
+void traceInputDelivered() {
+	if (isInputLatencyEnabled && SDL_AtomicGet(&inputLatencyStage) == LATENCY_STAGE_IDLE) {
+		inputLatencyFrames = 0;
+	}
 
-		fseek(f, 0, SEEK_SET);
+	advanceInputLatency(LATENCY_STAGE_IDLE, LATENCY_STAGE_DELIVERED);
+}
 
-		// length +1 to make sure there's room for null terminator
-		fileBuffer = malloc(length + 1);
+void traceInputRead() {
+	advanceInputLatency(LATENCY_STAGE_DELIVERED, LATENCY_STAGE_READ);
+}
 
-		if (fileBuffer) {
-			// replace seek length with read length
-			length = fread(fileBuffer, 1, length, f);
+void traceInputWrite() {
+	advanceInputLatency(LATENCY_STAGE_READ, LATENCY_STAGE_WRITTEN);
+}
 
-			// ensure null terminator
-			fileBuffer[length] = '\0';
-		}
+// `captureTime` is when the presented frame was taken from the engine, so a write
+// that the update thread made after that doesn't count as shown yet
+void traceInputPresent(Uint64 captureTime) {
+	int stage = isInputLatencyEnabled ? SDL_AtomicGet(&inputLatencyStage) : LATENCY_STAGE_IDLE;
 
-		fclose(f);
+	if (stage == LATENCY_STAGE_IDLE) {
+		return;
 	}
 
-	if (fileBuffer) {
-		duk_push_lstring(ctx, (const char *) fileBuffer, (duk_size_t) length);
-		duk_put_global_string(ctx, variableName);
-		success = 1;
-	}
+	inputLatencyFrames++;
 
-	return success;
+	if (stage == LATENCY_STAGE_WRITTEN && inputLatencyTimes[LATENCY_STAGE_WRITTEN] <= captureTime) {
+		Uint64* times = inputLatencyTimes;
+		addLatencySample(&inputReadLatency, times[LATENCY_STAGE_DELIVERED], times[LATENCY_STAGE_READ]);
+		addLatencySample(&inputWriteLatency, times[LATENCY_STAGE_DELIVERED], times[LATENCY_STAGE_WRITTEN]);
+		addLatencySample(&inputPresentLatency, times[LATENCY_STAGE_DELIVERED], SDL_GetPerformanceCounter());
+		inputPresentFrameCounts[inputLatencyFrames]++;
+		SDL_AtomicSet(&inputLatencyStage, LATENCY_STAGE_IDLE);
+	}
+	else if (inputLatencyFrames >= LATENCY_FRAME_MAX) {
+		inputLatencyDropCount++;
+		SDL_AtomicSet(&inputLatencyStage, LATENCY_STAGE_IDLE);
+	}
 }
 
-int loadEmbeddedScript(duk_context* ctx, char* fileStr) {
-	int success = 1;
+// returns the latency in milliseconds that `fraction` of the samples are at or under (to the bucket)
+int latencyPercentile(LatencyHistogram* histogram, float fraction) {
+	int target = (int) ceil(histogram->total * fraction);
+	int count = 0;
 
-	if (duk_peval_string(ctx, fileStr) != 0) {
-		printf("Load Embedded Script Error: %s\n", duk_safe_to_string(ctx, -1));
-		success = 0;
+	for (int i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+		count += histogram->counts[i];
+
+		if (count >= target) {
+			return i + 1;
+		}
 	}
-	duk_pop(ctx);
 
-	return success;
+	return LATENCY_BUCKET_COUNT;
 }
 
-int loadEmbeddedFile(duk_context* ctx, char* fileStr, char* variableName) {
-	duk_push_string(ctx, fileStr);
-	duk_put_global_string(ctx, variableName);
+void printLatencyHistogram(const char* name, LatencyHistogram* histogram) {
+	if (histogram->total <= 0) {
+		return;
+	}
 
-	return 1;
+	printf(
+		"%s: %.2f ms average, %d ms p50, %d ms p95, %.2f ms max\n",
+		name,
+		histogram->sum / histogram->total,
+		latencyPercentile(histogram, 0.5f),
+		latencyPercentile(histogram, 0.95f),
+		histogram->max);
+
+	int maxCount = 0;
+	for (int i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+		maxCount = histogram->counts[i] > maxCount ? histogram->counts[i] : maxCount;
+	}
+
+	for (int i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+		if (histogram->counts[i] > 0) {
+			int barLength = (histogram->counts[i] * 40 + maxCount - 1) / maxCount;
+			printf("  %3d%s ms %5d %.*s\n",
+				i,
+				i < LATENCY_BUCKET_COUNT - 1 ? " " : "+",
+				histogram->counts[i],
+				barLength,
+				"########################################");
+		}
+	}
 }
 
-/* # BITSY SYSTEM API IMPLEMENTATION */
+void printInputLatency() {
+	if (!isInputLatencyEnabled) {
+		return;
+	}
 
-/* ## CONSTANTS */
+	printf("Input latency (%d presses, %d without a visible change):\n", inputPresentLatency.total, inputLatencyDropCount);
+	printLatencyHistogram("Press to read", &inputReadLatency);
+	printLatencyHistogram("Press to memory write", &inputWriteLatency);
+	printLatencyHistogram("Press to present", &inputPresentLatency);
 
-// memory blocks
-#define BITSY_VIDEO 0
-#define BITSY_TEXTBOX 1
-#define BITSY_MAP1 2
-#define BITSY_MAP2 3
-#define BITSY_SOUND1 4
-#define BITSY_SOUND2 5
+	for (int i = 1; i <= LATENCY_FRAME_MAX; i++) {
+		if (inputPresentFrameCounts[i] > 0) {
+			printf("  shown on frame %2d: %d\n", i, inputPresentFrameCounts[i]);
+		}
+	}
+}
 
-#define BITSY_TILE_START 6
+/* # AUDIO */
 
-// graphics modes
-#define BITSY_GFX_VIDEO 0
-#define BITSY_GFX_MAP 1
+// samples per second (requested from the driver)
+#define AUDIO_SAMPLE_RATE 44100
+// size of the audio buffer in samples for each latency mode (requested from the driver)
+#define AUDIO_BUFFER_SIZE_LOW 128
+#define AUDIO_BUFFER_SIZE 256
+#define AUDIO_BUFFER_SIZE_POWERSAVE 2048
+// the callback fills its buffer in chunks of at most this many samples
+#define AUDIO_CHUNK_SIZE 256
+
+// latency modes
+#define AUDIO_LATENCY_LOW 0
+#define AUDIO_LATENCY_DEFAULT 1
+#define AUDIO_LATENCY_POWERSAVE 2
+
+int audioLatencyMode = AUDIO_LATENCY_DEFAULT;
+
+// the spec the driver actually gave us
+SDL_AudioDeviceID audioDevice = 0;
+int audioSampleRate = AUDIO_SAMPLE_RATE;
+int audioBufferSize = AUDIO_BUFFER_SIZE;
+
+// audio callback performance (measured on the audio thread, all times in milliseconds):
+// slow callbacks mean the callback itself is too expensive, while late ones with a short
+// duration mean the audio thread isn't being scheduled often enough
+typedef struct AudioStats {
+	int callbackCount;
+	double durationTotal; // time spent inside the callback
+	double durationMin;
+	double durationMax;
+	int intervalCount;
+	double intervalTotal; // time between the starts of consecutive callbacks
+	double intervalSquareTotal; // for the jitter (standard deviation of the interval)
+	double intervalMin;
+	double intervalMax;
+	int underrunCount; // callbacks that came too late to keep the device's buffer full
+	int slowCallbackCount; // callbacks that took longer than the audio they generated
+	int queueDepthMax; // most commands waiting in the queue at the start of a callback
+	int scheduledCommandMax; // most commands waiting for a later sample
+} AudioStats;
+
+// a callback is counted as an underrun if it starts this many buffers after the previous one
+#define AUDIO_UNDERRUN_THRESHOLD 1.5
+
+Uint64 audioCallbackPrevTime = 0;
+AudioStats audioStatsTotal; // since startup
+AudioStats audioStatsPeriod; // since the last periodic dump
+
+// commands the game thread had to drop because the queue was full
+SDL_atomic_t audioQueueDropCount;
+
+// periodic dumps (turned on with `--audio-stats`)
+float audioStatsDumpSeconds = 0.0f;
+char audioStatsFilePath[PATH_MAX] = "";
+FILE* audioStatsFile = NULL;
+Uint32 audioStatsPrevDumpTime = 0;
+
+Uint32 audioStep = 0; // global audio step counter (the step of the next sample to generate)
+float audioVolume = 0.0f; // global audio volume (range: 0.0 - 1.0)
 
-// text modes
-#define BITSY_TXT_HIREZ 0
-#define BITSY_TXT_LOREZ 1
+// blip envelopes are evaluated by the audio callback on every sample (see `bitsy.blip`)
+#define ENVELOPE_STEP_MAX 8
+
+typedef struct Envelope {
+	int attack; // segment lengths in samples
+	int decay;
+	int length;
+	int release;
+	float peak; // volume from 0.0 - 1.0 reached at the end of the attack
+	float sustain; // volume from 0.0 - 1.0 held during the sustain
+	float frequencies[ENVELOPE_STEP_MAX]; // in hertz
+	int frequencyCount;
+	int stepDelay; // samples before the first frequency step
+	int stepTime; // samples per frequency step
+	int isRepeating;
+} Envelope;
+
+// sound channels (only touched by the audio callback): the first two play tunes,
+// the rest are a pool of voices that sounds on `bitsy.SOUND_ANY` are given
+#define SOUND_CHANNEL_COUNT 8
+#define SOUND_POOL_START 2
+// channel index for sounds that should be given a voice from the pool
+#define SOUND_CHANNEL_ANY SOUND_CHANNEL_COUNT
+
+// each channel is a phase accumulator pulse oscillator: unlike counting whole samples per cycle,
+// this keeps pitches exact, and the PolyBLEP correction smooths the edges so high notes don't alias
+typedef struct SoundChannel {
+	float phase; // position in the current wave cycle (0.0 - 1.0)
+	float increment; // phase advanced per sample (frequency / sample rate)
+	float dutyCycle; // fraction of the cycle the pulse is high
+	float volume; // volume from 0.0 - 1.0
+	float volumeSlope; // change in volume per sample
+	int duration; // duration in *samples* (not frames or ms)
+	Envelope envelope;
+	int isEnvelopeActive;
+	int envelopeTime; // samples since the envelope started
+	int envelopeStep; // current frequency step
+	float pan; // stereo position from -1.0 (left) to 1.0 (right)
+	int priority; // voices can only be taken over by sounds with the same or higher priority
+} SoundChannel;
+
+SoundChannel soundChannels[SOUND_CHANNEL_COUNT];
+
+// mono output of one channel, and the stereo mix of all of them, for the current chunk
+float channelSamples[AUDIO_CHUNK_SIZE];
+float mixLeft[AUDIO_CHUNK_SIZE];
+float mixRight[AUDIO_CHUNK_SIZE];
+
+void setChannelFrequency(SoundChannel* channel, float frequency) {
+	// the phase is left alone so changing pitch mid-note doesn't click
+	channel->increment = frequency / audioSampleRate;
+
+	// silence anything that can't be represented at this sample rate
+	if (!(channel->increment > 0.0f && channel->increment < 0.5f)) {
+		channel->increment = 0.0f;
+	}
+}
 
-// size
-#define BITSY_TILE_SIZE 8
-#define BITSY_MAP_SIZE 16
-#define BITSY_VIDEO_SIZE 128
+// correction for a unit step at phase zero, smeared over one sample on either side
+static inline float polyBlep(float t, float dt, float invDt) {
+	float a = t * invDt;
+	float b = (t - 1.0f) * invDt;
 
-// button codes
-#define BITSY_BTN_UP 0
-#define BITSY_BTN_DOWN 1
-#define BITSY_BTN_LEFT 2
-#define BITSY_BTN_RIGHT 3
-#define BITSY_BTN_OK 4
-#define BITSY_BTN_MENU 5
+	// written as two selects (only one can be non-zero) so the compiler can vectorize it
+	float start = (t < dt) ? (a + a - (a * a) - 1.0f) : 0.0f;
+	float end = (t > 1.0f - dt) ? ((b * b) + b + b + 1.0f) : 0.0f;
 
-// pulse waves
-#define BITSY_PULSE_1_8 0
-#define BITSY_PULSE_1_4 1
-#define BITSY_PULSE_1_2 2
+	return start + end;
+}
 
-/* ## IO */
+// generates `count` samples of a channel's pulse wave and returns 0 if it's silent; each sample's phase is
+// computed from the start of the run (rather than accumulated) so the loop has no dependencies and can be vectorized
+int generatePulse(SoundChannel* channel, float* samples, int count) {
+	float phase = channel->phase;
+	float dt = channel->increment;
+	float duty = channel->dutyCycle;
+	float amplitude = channel->volume * audioVolume;
+	float amplitudeSlope = channel->volumeSlope * audioVolume;
 
-/* `bitsy.log(message)`
- *
- * Writes the string `message` to the debug console.
- */
-duk_ret_t bitsyLog(duk_context* ctx) {
-#ifdef ENABLE_BITSY_LOG
-	const char* printStr;
-	printStr = duk_safe_to_string(ctx, 0);
+	if (dt <= 0.0f || (amplitude <= 0.0f && amplitudeSlope <= 0.0f)) {
+		return 0;
+	}
 
-	printf("bitsy::%s\n", printStr);
-#endif
+	float invDt = 1.0f / dt;
 
-	return 0;
-}
+	for (int i = 0; i < count; i++) {
+		float t = phase + (i * dt);
+		t -= (int) t;
 
-/* `bitsy.button(code)`
- *
- * Returns `true` if the button referred to by `code` is held down. Otherwise it returns `false`.
- */
-duk_ret_t bitsyButton(duk_context* ctx) {
-	int buttonCode = duk_get_int(ctx, 0);
+		// position relative to the falling edge
+		float u = t + (1.0f - duty);
+		u -= (int) u;
 
-	int isAnyAlt = (isButtonLAlt || isButtonRAlt);
-	int isAnyCtrl = (isButtonLCtrl || isButtonRCtrl);
-	int isCtrlPlusR = isAnyCtrl && isButtonR;
-	int isPadFaceButton = isButtonPadA || isButtonPadB || isButtonPadX || isButtonPadY;
+		float value = (t < duty) ? 1.0f : 0.0f;
 
-	if (buttonCode == 0) {
-		duk_push_boolean(ctx, isButtonUp || isButtonW || isButtonPadUp);
-	}
-	else if (buttonCode == 1) {
-		duk_push_boolean(ctx, isButtonDown || isButtonS || isButtonPadDown);
-	}
-	else if (buttonCode == 2) {
-		duk_push_boolean(ctx, isButtonLeft || isButtonA || isButtonPadLeft);
-	}
-	else if (buttonCode == 3) {
-		duk_push_boolean(ctx, isButtonRight || isButtonD || isButtonPadRight);
-	}
-	else if (buttonCode == 4) {
-		duk_push_boolean(ctx, isButtonSpace || (isButtonReturn && !isAnyAlt) || isPadFaceButton);
-	}
-	else if (buttonCode == 5) {
-		duk_push_boolean(ctx, isButtonEscape || isCtrlPlusR || isButtonPadStart);
-	}
-	else {
-		duk_push_boolean(ctx, 0);
-	}
+		// the pulse ranges from 0 to 1, so each edge is half of a PolyBLEP step
+		value += 0.5f * (polyBlep(t, dt, invDt) - polyBlep(u, dt, invDt));
 
-	return 1;
-}
+		samples[i] = value * (amplitude + (i * amplitudeSlope));
+	}
 
-/* `bitsy.getGameData()`
- * 
- * Returns the game data as a string.
- */
-duk_ret_t bitsyGetGameData(duk_context* ctx) {
-	duk_peval_string(ctx, "__bitsybox_game_data__");
+	channel->phase = phase + (count * dt);
+	channel->phase -= (int) channel->phase;
 
 	return 1;
 }
 
-/* `bitsy.getFontData()`
- *
- * Returns the default font data as a string.
- */
-duk_ret_t bitsyGetFontData(duk_context* ctx) {
-	duk_peval_string(ctx, "__bitsybox_default_font__");
+void mixChannel(SoundChannel* channel, float* samples, float* left, float* right, int count) {
+	// constant power panning, so voices sound equally loud anywhere between the speakers
+	float angle = (channel->pan + 1.0f) * (M_PI / 4.0f);
+	float leftGain = cosf(angle);
+	float rightGain = sinf(angle);
 
-	return 1;
+	for (int i = 0; i < count; i++) {
+		left[i] += samples[i] * leftGain;
+		right[i] += samples[i] * rightGain;
+	}
 }
 
-/* ## GRAPHICS */
+// picks a voice from the pool for a sound on `bitsy.SOUND_ANY`: an idle one if there is one, otherwise
+// the lowest priority voice that isn't above `priority` (whichever is closest to finishing on a tie)
+int allocateChannel(int priority) {
+	int best = -1;
 
-/* `bitsy.graphicsMode(mode)`
- *
- * Sets the current graphics display `mode`, and also returns the current graphics mode.
- * If no mode input is given, just returns the current mode without changing it.
- */
-duk_ret_t bitsyGraphicsMode(duk_context* ctx) {
-	// set the graphics mode if there is an input mode
-	if (duk_get_top(ctx) >= 1) {
-		int prevGraphicsMode = curGraphicsMode;
-		curGraphicsMode = duk_get_int(ctx, 0);
+	for (int i = SOUND_POOL_START; i < SOUND_CHANNEL_COUNT; i++) {
+		SoundChannel* channel = &soundChannels[i];
+
+		if (channel->duration <= 0) {
+			return i;
+		}
 
-		if (curGraphicsMode != prevGraphicsMode) {
-			shouldRenderTextures = 1;
+		if (channel->priority <= priority) {
+			if (best < 0
+				|| channel->priority < soundChannels[best].priority
+				|| (channel->priority == soundChannels[best].priority && channel->duration < soundChannels[best].duration)) {
+				best = i;
+			}
 		}
 	}
 
-	// return the current graphics mode
-	duk_push_int(ctx, curGraphicsMode);
+	return best;
+}
 
-	return 1;
+int envelopeDuration(Envelope* envelope) {
+	return envelope->attack + envelope->decay + envelope->length + envelope->release;
 }
 
-/* `bitsy.textMode(mode)`
- *
- * Sets the current text display `mode`, and also returns the current text mode.
- * If no `mode` input is given, just returns the current mode without changing it.
- */
-duk_ret_t bitsyTextMode(duk_context* ctx) {
-	// set the text mode if there is an input mode
-	if (duk_get_top(ctx) >= 1) {
-		int prevTextMode =  curTextMode;
-		curTextMode = duk_get_int(ctx, 0);
+// finds the envelope segment at `time`, sets the `volume` at that time and its `slope` per sample,
+// and returns the number of samples left in the segment
+int envelopeSegment(Envelope* envelope, int time, float* volume, float* slope) {
+	int start = 0;
 
-		// update the textbox render scale
-		textboxRenderScale = (curTextMode == BITSY_TXT_LOREZ) ? 4 : 2;
+	// attack
+	if (time < start + envelope->attack) {
+		*slope = envelope->peak / envelope->attack;
+		*volume = *slope * (time - start);
+		return start + envelope->attack - time;
+	}
+	start += envelope->attack;
 
-		if (curTextMode != prevTextMode) {
-			shouldRenderTextures = 1;
-		}
+	// decay
+	if (time < start + envelope->decay) {
+		*slope = (envelope->sustain - envelope->peak) / envelope->decay;
+		*volume = envelope->peak + (*slope * (time - start));
+		return start + envelope->decay - time;
 	}
+	start += envelope->decay;
 
-	// return the current text mode
-	duk_push_int(ctx, curTextMode);
+	// sustain
+	if (time < start + envelope->length) {
+		*slope = 0.0f;
+		*volume = envelope->sustain;
+		return start + envelope->length - time;
+	}
+	start += envelope->length;
 
-	return 1;
+	// release
+	if (time < start + envelope->release) {
+		*slope = -envelope->sustain / envelope->release;
+		*volume = envelope->sustain + (*slope * (time - start));
+		return start + envelope->release - time;
+	}
+
+	*slope = 0.0f;
+	*volume = 0.0f;
+	return INT_MAX;
 }
 
-/* `bitsy.color(color, r, g, b)`
- *
- * Sets the color in the system palette at index `color` to a color defined by the color parameters 
- * `r` (red), `g` (green), and `b` (blue). These values must be between 0 and 255. 
- * (For example, `bitsy.color(2, 0, 0, 0)` sets the color at index 2 to black and 
- * `bitsy.color(2, 255, 255, 255)` set the color at the same index to white.)
- */
-duk_ret_t bitsyColor(duk_context* ctx) {
-	int paletteIndex = duk_get_int(ctx, 0);
-	int r = duk_get_int(ctx, 1);
-	int g = duk_get_int(ctx, 2);
-	int b = duk_get_int(ctx, 3);
+// returns the frequency step playing at `time` and sets `remaining` to the number of samples until it changes
+int envelopeFrequencyStep(Envelope* envelope, int time, int* remaining) {
+	if (envelope->frequencyCount <= 1 || envelope->stepTime <= 0) {
+		*remaining = INT_MAX;
+		return 0;
+	}
 
-	systemPalette[paletteIndex] = (Color) { r, g, b };
+	if (time < envelope->stepDelay) {
+		*remaining = envelope->stepDelay - time;
+		return 0;
+	}
 
-	// printf("bitsyColor %i - %i %i %i\n", paletteIndex, r, g, b);
+	int step = (time - envelope->stepDelay) / envelope->stepTime;
+	*remaining = envelope->stepTime - ((time - envelope->stepDelay) % envelope->stepTime);
 
-	shouldRenderTextures = 1;
+	if (envelope->isRepeating) {
+		return step % envelope->frequencyCount;
+	}
+	else if (step >= envelope->frequencyCount - 1) {
+		*remaining = INT_MAX;
+		return envelope->frequencyCount - 1;
+	}
 
-	return 0;
+	return step;
 }
 
-/* `bitsy.tile()`
- *
- * Allocates a new tile and returns its memory block location.
- */
-duk_ret_t bitsyTile(duk_context* ctx) {
-	// search the tile texture array for an empty entry
-	int tileIndex = BITSY_TILE_START;
-	while (tileIndex < TEXTURE_MAX && textures[tileIndex] != NULL) {
-		tileIndex++;
+void stopChannelEnvelope(SoundChannel* channel) {
+	channel->isEnvelopeActive = 0;
+	channel->volumeSlope = 0.0f;
+}
+
+// updates the channel's frequency and volume ramp from its envelope, and shortens `runLength`
+// so that the run ends when the envelope's next segment or frequency step begins
+void updateChannelEnvelope(SoundChannel* channel, int* runLength) {
+	Envelope* envelope = &channel->envelope;
+
+	if (channel->envelopeTime >= envelopeDuration(envelope)) {
+		stopChannelEnvelope(channel);
+		channel->volume = 0.0f;
+		return;
 	}
 
-	// return nothing if there is no available space
-	if (tileIndex >= TEXTURE_MAX) {
-		return 0;
+	int stepRemaining;
+	int step = envelopeFrequencyStep(envelope, channel->envelopeTime, &stepRemaining);
+	if (step != channel->envelopeStep) {
+		channel->envelopeStep = step;
+		setChannelFrequency(channel, envelope->frequencies[step]);
 	}
 
-	textures[tileIndex] = SDL_CreateTexture(
-		renderer,
-		SDL_PIXELFORMAT_RGB888,
-		SDL_TEXTUREACCESS_TARGET,
-		(BITSY_TILE_SIZE * renderScale),
-		(BITSY_TILE_SIZE * renderScale));
-	allocateMemoryBlock(tileIndex, BITSY_TILE_SIZE * BITSY_TILE_SIZE);
+	int segmentRemaining = envelopeSegment(envelope, channel->envelopeTime, &channel->volume, &channel->volumeSlope);
 
-	duk_push_int(ctx, tileIndex);
+	*runLength = stepRemaining < *runLength ? stepRemaining : *runLength;
+	*runLength = segmentRemaining < *runLength ? segmentRemaining : *runLength;
+}
 
-	return 1;
+/* ## TUNE SEQUENCER */
+
+// tunes are sequenced inside the audio callback so that every note starts on an exact
+// sample boundary, no matter how long the game loop takes to run a frame
+#define TUNE_STEP_MAX (16 * 16) // 16 bars of sixteenth notes
+
+typedef struct TuneNote {
+	float frequency; // in hertz
+	int beats; // length in sixteenth note steps (zero for a rest)
+} TuneNote;
+
+typedef struct TuneSequence {
+	int stepCount;
+	int stepLength; // length of one sixteenth note step in samples
+	TuneNote melody[TUNE_STEP_MAX]; // played on channel 1
+	TuneNote harmony[TUNE_STEP_MAX]; // played on channel 2
+	float dutyCycleA; // pulse wave duty cycle for each channel
+	float dutyCycleB;
+	float volume; // volume from 0.0 - 1.0
+} TuneSequence;
+
+// the audio callback's copy of the current tune
+TuneSequence tuneSequence;
+
+int isTunePlaying = 0;
+int isTunePaused = 0;
+int tuneStep = -1; // most recently played step (-1 before the first one)
+int tuneStepTimer = 0; // samples left until the next step
+
+// published for the game thread (-1 when no tune is playing)
+SDL_atomic_t tunePosition;
+
+void playChannelNote(SoundChannel* channel, float frequency, int beats, float dutyCycle) {
+	stopChannelEnvelope(channel);
+	channel->dutyCycle = dutyCycle;
+	setChannelFrequency(channel, frequency);
+	channel->volume = tuneSequence.volume;
+	channel->duration = beats * tuneSequence.stepLength;
 }
 
-/* `bitsy.delete(tile)`
- *
- * Deletes the tile at the specified memory block location.
- */
-duk_ret_t bitsyDelete(duk_context* ctx) {
-	int tile = duk_get_int(ctx, 0);
-	if (tile >= BITSY_TILE_START && tile < TEXTURE_MAX && textures[tile] != NULL) {
-		printf("BITSY DELETE %i\n", tile);
+void stepTune() {
+	tuneStep = (tuneStep + 1) % tuneSequence.stepCount;
+	tuneStepTimer = tuneSequence.stepLength;
+	SDL_AtomicSet(&tunePosition, tuneStep);
 
-		// destroy the texture & nullify the reference to it
-		SDL_DestroyTexture(textures[tile]);
-		textures[tile] = NULL;
+	TuneNote* melodyNote = &tuneSequence.melody[tuneStep];
+	if (melodyNote->beats > 0) {
+		playChannelNote(&soundChannels[0], melodyNote->frequency, melodyNote->beats, tuneSequence.dutyCycleA);
+	}
 
-		// free the associated system memory
-		freeMemoryBlock(tile);
+	TuneNote* harmonyNote = &tuneSequence.harmony[tuneStep];
+	if (harmonyNote->beats > 0) {
+		playChannelNote(&soundChannels[1], harmonyNote->frequency, harmonyNote->beats, tuneSequence.dutyCycleB);
 	}
+}
 
-	return 0;
+/* ## AUDIO COMMAND QUEUE */
+
+// the game thread never writes channel state directly: it pushes timestamped commands into a
+// single producer, single consumer ring, and the audio callback applies them on the exact sample
+#define AUDIO_COMMAND_MAX 256 // must be a power of two
+
+// command types
+#define AUDIO_SOUND 0
+#define AUDIO_FREQUENCY 1
+#define AUDIO_VOLUME 2
+#define AUDIO_TUNE 3
+#define AUDIO_TUNE_STOP 4
+#define AUDIO_TUNE_PAUSE 5
+#define AUDIO_BLIP 6
+#define AUDIO_VOICE 7
+
+// flags for the optional settings of AUDIO_SOUND
+#define AUDIO_SET_DURATION (1 << 0)
+#define AUDIO_SET_VOLUME (1 << 1)
+#define AUDIO_SET_PULSE (1 << 2)
+
+typedef struct AudioCommand {
+	int type;
+	Uint32 time; // audio step to apply the command on (anything in the past is applied right away)
+	int channel; // index into soundChannels (or SOUND_CHANNEL_ANY)
+	int flags;
+	int duration; // in samples
+	float frequency; // in hertz
+	float volume; // volume from 0.0 - 1.0
+	float dutyCycle;
+	int value; // tune slot or pause state
+	Envelope envelope;
+	float pan; // voice settings
+	int priority;
+} AudioCommand;
+
+AudioCommand audioQueue[AUDIO_COMMAND_MAX];
+SDL_atomic_t audioQueueHead; // next command to read (written by the audio callback)
+SDL_atomic_t audioQueueTail; // next free slot (written by the game thread)
+
+// commands taken off the queue, sorted by time (only touched by the audio callback)
+AudioCommand scheduledCommands[AUDIO_COMMAND_MAX];
+int scheduledCommandCount = 0;
+
+// audio step where the next buffer starts, so the game thread can schedule ahead of it
+SDL_atomic_t audioClock;
+
+// tunes are too big to copy through the queue, so they're passed in one of these slots instead
+#define TUNE_SLOT_COUNT 3
+TuneSequence tuneSlots[TUNE_SLOT_COUNT];
+SDL_atomic_t tuneSlotBusy[TUNE_SLOT_COUNT];
+
+int isAudioTimeDue(Uint32 time, Uint32 step) {
+	// wraparound safe comparison
+	return (Sint32) (time - step) <= 0;
 }
 
-/* `bitsy.fill(block, value)`
- *
- * Fills an entire memory `block` with a number `value`. 
- * Can be used to clear blocks such as video memory, tilemap memory, and tile memory.
- */
-duk_ret_t bitsyFill(duk_context* ctx) {
-	int block = duk_get_int(ctx, 0);
-	int value = duk_get_int(ctx, 1);
+// called by the game thread
+int pushAudioCommand(AudioCommand* command) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
 
-	// verify valid block
-	if (isMemoryBlockValid(block)) {
-		// verify valid data
-		if (value >= 0 && value < 256) {
-			// everything is ok - set the data!
-			for (int i = 0; i < memory[block].size; i++) {
-				memory[block].data[i] = value;
-			}
+	int tail = SDL_AtomicGet(&audioQueueTail);
+	int nextTail = (tail + 1) & (AUDIO_COMMAND_MAX - 1);
 
-			if (textures[block] != NULL) {
-				shouldRenderTextures = 1;
-			}
-		}
+	if (nextTail == SDL_AtomicGet(&audioQueueHead)) {
+		// the queue is full: drop the command rather than block the game
+		SDL_AtomicIncRef(&audioQueueDropCount);
+		return 0;
 	}
 
-	return 0;
+	audioQueue[tail] = *command;
+	SDL_AtomicSet(&audioQueueTail, nextTail);
+
+	return 1;
 }
 
-/* `bitsy.set(block, index, value)`
- *
- * Sets the value at `index` within a memory `block` with a number `value`.
- */
-duk_ret_t bitsySet(duk_context* ctx) {
-	int block = duk_get_int(ctx, 0);
-	int index = duk_get_int(ctx, 1);
-	int value = duk_get_int(ctx, 2);
+void scheduleAudioCommands() {
+	int head = SDL_AtomicGet(&audioQueueHead);
+	int tail = SDL_AtomicGet(&audioQueueTail);
 
-	// printf("BITSY SET %i %i %i - GFX %i\n", block, index, value, curGraphicsMode);
+	while (head != tail && scheduledCommandCount < AUDIO_COMMAND_MAX) {
+		// insert after any command with the same time so that commands stay in order
+		int i = scheduledCommandCount;
+		while (i > 0 && !isAudioTimeDue(scheduledCommands[i - 1].time, audioQueue[head].time)) {
+			scheduledCommands[i] = scheduledCommands[i - 1];
+			i--;
+		}
 
-	// verify valid block
-	if (isMemoryBlockValid(block)) {
-		// verify valid location in block
-		if (index >= 0 && index < memory[block].size) {
-			// verify valid data
-			if (value >= 0 && value < 256) {
-				// everything is ok - set the data!
-				memory[block].data[index] = value;
+		scheduledCommands[i] = audioQueue[head];
+		scheduledCommandCount++;
 
-				if (textures[block] != NULL) {
-					shouldRenderTextures = 1;
-				}
-			}
-		}
+		head = (head + 1) & (AUDIO_COMMAND_MAX - 1);
 	}
 
-	return 0;
+	SDL_AtomicSet(&audioQueueHead, head);
 }
 
-/* `bitsy.textbox(visible, x, y, w, h)`
- *
- * Updates the textbox display settings.
- * If `visible` is `true` the textbox is rendered, otherwise it's hidden.
- * The textbox's position (relative the main display's coordinate space)
- * is defined by `x` and `y`. And the size of the textbox
- * (in its internal resolution) is defined by `w` (width) and `h` (height).
- * Omitted parameters are unchanged (For example, you can just reveal
- * the textbox without changing its position and size using `bitsy.textbox(true)`).
- */
-duk_ret_t bitsyTextbox(duk_context* ctx) {
-	if (duk_get_top(ctx) >= 1) {
-		isTextboxVisible = duk_get_boolean(ctx, 0);
-	}
+void applyAudioCommand(AudioCommand* command) {
+	int channelIndex = command->channel;
 
-	if (duk_get_top(ctx) >= 3) {
-		textboxX = duk_get_int(ctx, 1);
-		textboxY = duk_get_int(ctx, 2);
-	}
+	if (channelIndex == SOUND_CHANNEL_ANY) {
+		channelIndex = allocateChannel(command->priority);
 
-	if (duk_get_top(ctx) >= 5) {
-		textboxWidth = duk_get_int(ctx, 3);
-		textboxHeight = duk_get_int(ctx, 4);
+		if (channelIndex < 0) {
+			// every voice is busy with something more important
+			return;
+		}
 
-		// create a new texture when the size changes
-		textures[BITSY_TEXTBOX] = SDL_CreateTexture(
-			renderer,
-			SDL_PIXELFORMAT_RGB888,
-			SDL_TEXTUREACCESS_TARGET,
-			(textboxWidth * textboxRenderScale),
-			(textboxHeight * textboxRenderScale));
-		allocateMemoryBlock(BITSY_TEXTBOX, textboxWidth * textboxHeight);
+		soundChannels[channelIndex].pan = command->pan;
+		soundChannels[channelIndex].priority = command->priority;
 	}
 
-	return 0;
-}
+	SoundChannel* channel = &soundChannels[channelIndex];
 
-/* ## SOUND */
+	switch (command->type) {
+		case AUDIO_SOUND:
+			stopChannelEnvelope(channel);
 
-/* `bitsy.sound(channel, duration, frequency, volume, pulse)`
- *
- * Updates all audio settings for one sound `channel` (either `bitsy.SOUND1` or `bitsy.SOUND2`).
- * The `duration` is in milliseconds, `frequency` is in decihertz (dHz), `volume` must be between 0 and 15,
- * and `pulse` is one of the pulse wave constants.
- */
-duk_ret_t bitsySound(duk_context* ctx) {
-	if (duk_get_top(ctx) >= 1) {
-		int channel = duk_get_int(ctx, 0);
-		float frequency = 0.0f;
-
-		switch (channel) {
-			case BITSY_SOUND1:
-				if (duk_get_top(ctx) >= 2) {
-					// duration is passed in as milliseconds, but here we convert it
-					// to samples since that is easier to sync with the SDL audio system
-					durationChannel1 = floor((duk_get_int(ctx, 1) / 1000.0f) * AUDIO_SAMPLE_RATE);
-				}
+			if (command->flags & AUDIO_SET_DURATION) {
+				channel->duration = command->duration;
+			}
 
-				if (duk_get_top(ctx) >= 3) {
-					frequency = duk_get_int(ctx, 2) / 100.0f;
-				}
+			if (command->flags & AUDIO_SET_VOLUME) {
+				channel->volume = command->volume;
+			}
 
-				if (duk_get_top(ctx) >= 4) {
-					volumeChannel1 = duk_get_int(ctx, 3) / 15.0f;
-				}
+			if (command->flags & AUDIO_SET_PULSE) {
+				channel->dutyCycle = command->dutyCycle;
+			}
 
-				if (duk_get_top(ctx) >= 5) {
-					dutyChannel1 = duk_get_int(ctx, 4);
-				}
+			setChannelFrequency(channel, command->frequency);
+			break;
+		case AUDIO_FREQUENCY:
+			stopChannelEnvelope(channel);
+			setChannelFrequency(channel, command->frequency);
+			break;
+		case AUDIO_VOLUME:
+			stopChannelEnvelope(channel);
+			channel->volume = command->volume;
+			break;
+		case AUDIO_BLIP:
+			channel->envelope = command->envelope;
+			channel->isEnvelopeActive = 1;
+			channel->envelopeTime = 0;
+			channel->envelopeStep = -1;
+			channel->dutyCycle = command->dutyCycle;
+			channel->duration = envelopeDuration(&command->envelope);
+			break;
+		case AUDIO_VOICE:
+			channel->pan = command->pan;
+			channel->priority = command->priority;
+			break;
+		case AUDIO_TUNE:
+			tuneSequence = tuneSlots[command->value];
+			SDL_AtomicSet(&tuneSlotBusy[command->value], 0);
+
+			tuneStep = -1;
+			tuneStepTimer = tuneSequence.stepLength;
+			isTunePaused = 0;
+			isTunePlaying = 1;
+			SDL_AtomicSet(&tunePosition, tuneStep);
+			break;
+		case AUDIO_TUNE_STOP:
+			isTunePlaying = 0;
+			SDL_AtomicSet(&tunePosition, -1);
+			break;
+		case AUDIO_TUNE_PAUSE:
+			isTunePaused = command->value;
+			break;
+	}
+}
 
-				switch (dutyChannel1) {
-					case BITSY_PULSE_1_8:
-						soundChannel1 = wave(frequency, (1.0f / 8.0f));
-						break;
-					case BITSY_PULSE_1_4:
-						soundChannel1 = wave(frequency, (1.0f / 4.0f));
-						break;
-					case BITSY_PULSE_1_2:
-						soundChannel1 = wave(frequency, (1.0f / 2.0f));
-						break;
-				}
-				break;
-			case BITSY_SOUND2:
-				if (duk_get_top(ctx) >= 2) {
-					// duration is passed in as milliseconds, but here we convert it
-					// to samples since that is easier to sync with the SDL audio system
-					durationChannel2 = floor((duk_get_int(ctx, 1) / 1000.0f) * AUDIO_SAMPLE_RATE);
-				}
+// fills `sampleCount` (up to AUDIO_CHUNK_SIZE) interleaved stereo samples
+void generateAudio(float* fstream, int sampleCount) {
+	int nextCommand = 0;
+
+	// the buffer is generated in runs of samples where nothing changes,
+	// split wherever a command, tune step, or note ending is due
+	int i = 0;
+	while (i < sampleCount) {
+		// apply any commands that are due on this sample
+		while (nextCommand < scheduledCommandCount && isAudioTimeDue(scheduledCommands[nextCommand].time, audioStep)) {
+			applyAudioCommand(&scheduledCommands[nextCommand]);
+			nextCommand++;
+		}
 
-				if (duk_get_top(ctx) >= 3) {
-					frequency = duk_get_int(ctx, 2) / 100.0f;
-				}
+		// advance the tune sequencer
+		int isTuneRunning = isTunePlaying && !isTunePaused;
+		if (isTuneRunning && tuneStepTimer <= 0) {
+			stepTune();
+		}
 
-				if (duk_get_top(ctx) >= 4) {
-					volumeChannel2 = duk_get_int(ctx, 3) / 15.0f;
-				}
+		// find the end of the run
+		int runLength = sampleCount - i;
 
-				if (duk_get_top(ctx) >= 5) {
-					dutyChannel2 = duk_get_int(ctx, 4);
-				}
+		if (nextCommand < scheduledCommandCount) {
+			int untilCommand = (Sint32) (scheduledCommands[nextCommand].time - audioStep);
+			runLength = untilCommand < runLength ? untilCommand : runLength;
+		}
 
-				switch (dutyChannel2) {
-					case BITSY_PULSE_1_8:
-						soundChannel2 = wave(frequency, (1.0f / 8.0f));
-						break;
-					case BITSY_PULSE_1_4:
-						soundChannel2 = wave(frequency, (1.0f / 4.0f));
-						break;
-					case BITSY_PULSE_1_2:
-						soundChannel2 = wave(frequency, (1.0f / 2.0f));
-						break;
-				}
-				break;
+		if (isTuneRunning) {
+			runLength = tuneStepTimer < runLength ? tuneStepTimer : runLength;
 		}
-	}
 
-	return 0;
-}
+		for (int j = 0; j < SOUND_CHANNEL_COUNT; j++) {
+			if (soundChannels[j].isEnvelopeActive) {
+				updateChannelEnvelope(&soundChannels[j], &runLength);
+			}
 
-/* `bitsy.frequency(channel, frequency)`
- *
- * Sets the `frequency` for one sound `channel`. Units are decihertz (dHz).
- */
-duk_ret_t bitsyFrequency(duk_context* ctx) {
-	int channel = duk_get_int(ctx, 0);
-	float frequency = duk_get_int(ctx, 1) / 100.0f;
-
-	switch (channel) {
-		case BITSY_SOUND1:
-			switch (dutyChannel1) {
-				case BITSY_PULSE_1_8:
-					soundChannel1 = wave(frequency, (1.0f / 8.0f));
-					break;
-				case BITSY_PULSE_1_4:
-					soundChannel1 = wave(frequency, (1.0f / 4.0f));
-					break;
-				case BITSY_PULSE_1_2:
-					soundChannel1 = wave(frequency, (1.0f / 2.0f));
-					break;
+			// mute channels once their duration runs out
+			if (soundChannels[j].duration <= 0) {
+				stopChannelEnvelope(&soundChannels[j]);
+				soundChannels[j].volume = 0.0f;
+				soundChannels[j].duration = 0;
 			}
-			break;
-		case BITSY_SOUND2:
-			switch (dutyChannel2) {
-				case BITSY_PULSE_1_8:
-					soundChannel2 = wave(frequency, (1.0f / 8.0f));
-					break;
-				case BITSY_PULSE_1_4:
-					soundChannel2 = wave(frequency, (1.0f / 4.0f));
-					break;
-				case BITSY_PULSE_1_2:
-					soundChannel2 = wave(frequency, (1.0f / 2.0f));
-					break;
+			else if (soundChannels[j].duration < runLength) {
+				runLength = soundChannels[j].duration;
 			}
-			break;
-	}
+		}
 
-	return 0;
-}
+		// calculate pulse wave samples for each channel and mix them together (skipping silent ones)
+		memset(&mixLeft[i], 0, runLength * sizeof(float));
+		memset(&mixRight[i], 0, runLength * sizeof(float));
 
-/* `bitsy.volume(channel, volume)`
- *
- * Sets the `volume` for one sound `channel`. Volume must be between 0 and 15 (inclusive).
- */
-duk_ret_t bitsyVolume(duk_context* ctx) {
-	int channel = duk_get_int(ctx, 0);
-	int volume = duk_get_int(ctx, 1);
+		for (int j = 0; j < SOUND_CHANNEL_COUNT; j++) {
+			if (generatePulse(&soundChannels[j], channelSamples, runLength)) {
+				mixChannel(&soundChannels[j], channelSamples, &mixLeft[i], &mixRight[i], runLength);
+			}
 
-	switch (channel) {
-		case BITSY_SOUND1:
-			volumeChannel1 = volume / 15.0f;
-			break;
-		case BITSY_SOUND2:
-			volumeChannel2 = volume / 15.0f;
-			break;
-	}
+			soundChannels[j].duration -= runLength;
 
-	return 0;
-}
+			if (soundChannels[j].isEnvelopeActive) {
+				soundChannels[j].envelopeTime += runLength;
+			}
+		}
 
-/* ## EVENTS */
+		if (isTuneRunning) {
+			tuneStepTimer -= runLength;
+		}
 
-/* `bitsy.loop(fn)`
- *
- * The system will call function `fn` on every update loop. 
- * It will attempt to run at 60fps, but `fn` will also receive 
- * an input parameter `dt` with the delta time since the previous loop (in milliseconds).
- */
-duk_ret_t bitsyLoop(duk_context* ctx) {
-	duk_put_global_string(ctx, "__bitsybox_on_update__");
+		audioStep += runLength;
+		i += runLength;
+	}
 
-	return 0;
+	// clip anything out of range when a lot of voices play at once
+	for (int k = 0; k < sampleCount; k++) {
+		fstream[(k * 2) + 0] = fminf(fmaxf(mixLeft[k], -1.0f), 1.0f);
+		fstream[(k * 2) + 1] = fminf(fmaxf(mixRight[k], -1.0f), 1.0f);
+	}
+
+	// keep the commands that are scheduled for a later buffer
+	scheduledCommandCount -= nextCommand;
+	memmove(scheduledCommands, &scheduledCommands[nextCommand], scheduledCommandCount * sizeof(AudioCommand));
 }
 
-void initBitsyInterface(duk_context* ctx) {
-	// BITSY API v0.2
+void recordAudioStats(AudioStats* stats, double interval, double duration, int queueDepth) {
+	double bufferTime = audioBufferSize * 1000.0 / audioSampleRate;
 
-	// create system object
-	duk_idx_t bitsySystemIdx = duk_push_object(ctx);
+	if (stats->callbackCount <= 0 || duration < stats->durationMin) {
+		stats->durationMin = duration;
+	}
 
-	// CONSTANTS
+	if (stats->callbackCount <= 0 || duration > stats->durationMax) {
+		stats->durationMax = duration;
+	}
 
-	// memory blocks
-	duk_push_int(ctx, BITSY_VIDEO);
-	duk_put_prop_string(ctx, bitsySystemIdx, "VIDEO");
+	stats->durationTotal += duration;
+	stats->callbackCount++;
 
-	duk_push_int(ctx, BITSY_TEXTBOX);
-	duk_put_prop_string(ctx, bitsySystemIdx, "TEXTBOX");
+	if (duration > bufferTime) {
+		stats->slowCallbackCount++;
+	}
 
-	duk_push_int(ctx, BITSY_MAP1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "MAP1");
+	// the first callback has nothing to measure its interval against
+	if (interval >= 0.0) {
+		if (stats->intervalCount <= 0 || interval < stats->intervalMin) {
+			stats->intervalMin = interval;
+		}
 
-	duk_push_int(ctx, BITSY_MAP2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "MAP2");
+		if (stats->intervalCount <= 0 || interval > stats->intervalMax) {
+			stats->intervalMax = interval;
+		}
 
-	duk_push_int(ctx, BITSY_SOUND1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND1");
+		stats->intervalTotal += interval;
+		stats->intervalSquareTotal += interval * interval;
+		stats->intervalCount++;
 
-	duk_push_int(ctx, BITSY_SOUND2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND2");
+		if (interval > bufferTime * AUDIO_UNDERRUN_THRESHOLD) {
+			stats->underrunCount++;
+		}
+	}
 
-	// graphics modes
-	duk_push_int(ctx, BITSY_GFX_VIDEO);
-	duk_put_prop_string(ctx, bitsySystemIdx, "GFX_VIDEO");
+	if (queueDepth > stats->queueDepthMax) {
+		stats->queueDepthMax = queueDepth;
+	}
 
-	duk_push_int(ctx, BITSY_GFX_MAP);
-	duk_put_prop_string(ctx, bitsySystemIdx, "GFX_MAP");
+	if (scheduledCommandCount > stats->scheduledCommandMax) {
+		stats->scheduledCommandMax = scheduledCommandCount;
+	}
+}
 
-	// text modes
-	duk_push_int(ctx, BITSY_TXT_HIREZ);
-	duk_put_prop_string(ctx, bitsySystemIdx, "TXT_HIREZ");
+void audioCallback(void* userdata, Uint8* stream, int len) {
+	float* fstream = (float*) stream;
 
-	duk_push_int(ctx, BITSY_TXT_LOREZ);
-	duk_put_prop_string(ctx, bitsySystemIdx, "TXT_LOREZ");
+	// the buffer size comes from the obtained spec, which may not be what we asked for
+	int sampleCount = len / (sizeof(float) * 2);
 
-	// sizes
-	duk_push_int(ctx, BITSY_TILE_SIZE);
-	duk_put_prop_string(ctx, bitsySystemIdx, "TILE_SIZE");
+	Uint64 startTime = SDL_GetPerformanceCounter();
+	int queueDepth = (SDL_AtomicGet(&audioQueueTail) - SDL_AtomicGet(&audioQueueHead)) & (AUDIO_COMMAND_MAX - 1);
 
-	duk_push_int(ctx, BITSY_MAP_SIZE);
-	duk_put_prop_string(ctx, bitsySystemIdx, "MAP_SIZE");
+	scheduleAudioCommands();
 
-	duk_push_int(ctx, BITSY_VIDEO_SIZE);
-	duk_put_prop_string(ctx, bitsySystemIdx, "VIDEO_SIZE");
+	for (int i = 0; i < sampleCount; i += AUDIO_CHUNK_SIZE) {
+		int chunkSize = (sampleCount - i) < AUDIO_CHUNK_SIZE ? (sampleCount - i) : AUDIO_CHUNK_SIZE;
+		generateAudio(&fstream[i * 2], chunkSize);
+	}
 
-	// button codes
-	duk_push_int(ctx, BITSY_BTN_UP);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_UP");
+	SDL_AtomicSet(&audioClock, (int) audioStep);
 
-	duk_push_int(ctx, BITSY_BTN_DOWN);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_DOWN");
+	double timerScale = 1000.0 / SDL_GetPerformanceFrequency();
+	double interval = audioCallbackPrevTime > 0 ? (startTime - audioCallbackPrevTime) * timerScale : -1.0;
+	double duration = (SDL_GetPerformanceCounter() - startTime) * timerScale;
+	recordAudioStats(&audioStatsTotal, interval, duration, queueDepth);
+	recordAudioStats(&audioStatsPeriod, interval, duration, queueDepth);
+	audioCallbackPrevTime = startTime;
 
-	duk_push_int(ctx, BITSY_BTN_LEFT);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_LEFT");
+	traceThreadName("audio");
+	traceSpan("audio", "audio callback", startTime, SDL_GetPerformanceCounter());
+}
 
-	duk_push_int(ctx, BITSY_BTN_RIGHT);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_RIGHT");
+int audioBufferSizeForLatency(int latencyMode) {
+	switch (latencyMode) {
+		case AUDIO_LATENCY_LOW:
+			return AUDIO_BUFFER_SIZE_LOW;
+		case AUDIO_LATENCY_POWERSAVE:
+			return AUDIO_BUFFER_SIZE_POWERSAVE;
+		default:
+			return AUDIO_BUFFER_SIZE;
+	}
+}
 
-	duk_push_int(ctx, BITSY_BTN_OK);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_OK");
+// copies the audio thread's stats (optionally starting a new period)
+void readAudioStats(AudioStats* total, AudioStats* period, int shouldResetPeriod) {
+	SDL_LockAudioDevice(audioDevice);
 
-	duk_push_int(ctx, BITSY_BTN_MENU);
-	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_MENU");
+	if (total != NULL) {
+		*total = audioStatsTotal;
+	}
 
-	// pulse waves
-	duk_push_int(ctx, BITSY_PULSE_1_8);
-	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_8");
+	if (period != NULL) {
+		*period = audioStatsPeriod;
+	}
 
-	duk_push_int(ctx, BITSY_PULSE_1_4);
-	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_4");
+	if (shouldResetPeriod) {
+		memset(&audioStatsPeriod, 0, sizeof(AudioStats));
+	}
 
-	duk_push_int(ctx, BITSY_PULSE_1_2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_2");
+	SDL_UnlockAudioDevice(audioDevice);
+}
 
-	// IO
+double audioStatsJitter(AudioStats* stats) {
+	if (stats->intervalCount <= 0) {
+		return 0.0;
+	}
 
-	duk_push_c_function(ctx, bitsyLog, 1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "log");
+	double mean = stats->intervalTotal / stats->intervalCount;
+	double variance = (stats->intervalSquareTotal / stats->intervalCount) - (mean * mean);
 
-	duk_push_c_function(ctx, bitsyButton, 1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "button");
+	return variance > 0.0 ? sqrt(variance) : 0.0;
+}
 
-	duk_push_c_function(ctx, bitsyGetGameData, 0);
-	duk_put_prop_string(ctx, bitsySystemIdx, "getGameData");
+void printAudioStats(AudioStats* stats) {
+	if (stats->callbackCount <= 0) {
+		return;
+	}
 
-	duk_push_c_function(ctx, bitsyGetFontData, 0);
-	duk_put_prop_string(ctx, bitsySystemIdx, "getFontData");
+	printf(
+		"Audio callback duration: %.3f ms average, %.3f ms min, %.3f ms max (%d slower than realtime)\n",
+		stats->durationTotal / stats->callbackCount,
+		stats->durationMin,
+		stats->durationMax,
+		stats->slowCallbackCount);
+
+	if (stats->intervalCount > 0) {
+		printf(
+			"Audio callback interval: %.2f ms average, %.2f ms min, %.2f ms max, %.2f ms jitter (expected %.2f ms, %d underruns)\n",
+			stats->intervalTotal / stats->intervalCount,
+			stats->intervalMin,
+			stats->intervalMax,
+			audioStatsJitter(stats),
+			audioBufferSize * 1000.0 / audioSampleRate,
+			stats->underrunCount);
+	}
 
-	// GRAPHICS
+	printf(
+		"Audio command queue: %d max depth, %d max scheduled, %d dropped\n",
+		stats->queueDepthMax,
+		stats->scheduledCommandMax,
+		SDL_AtomicGet(&audioQueueDropCount));
+}
 
-	duk_push_c_function(ctx, bitsyGraphicsMode, DUK_VARARGS);
-	duk_put_prop_string(ctx, bitsySystemIdx, "graphicsMode");
+void writeAudioStatsRow(FILE* f, Uint32 time, AudioStats* stats) {
+	fprintf(
+		f,
+		"%u,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%d,%d\n",
+		time,
+		stats->callbackCount,
+		stats->callbackCount > 0 ? stats->durationTotal / stats->callbackCount : 0.0,
+		stats->durationMin,
+		stats->durationMax,
+		stats->intervalCount > 0 ? stats->intervalTotal / stats->intervalCount : 0.0,
+		stats->intervalMin,
+		stats->intervalMax,
+		audioStatsJitter(stats),
+		stats->underrunCount,
+		stats->slowCallbackCount,
+		stats->queueDepthMax,
+		stats->scheduledCommandMax,
+		SDL_AtomicGet(&audioQueueDropCount));
+	fflush(f);
+}
 
-	duk_push_c_function(ctx, bitsyTextMode, DUK_VARARGS);
-	duk_put_prop_string(ctx, bitsySystemIdx, "textMode");
+// called from the game loop: dumps the stats for the last period every `--audio-stats` seconds
+void updateAudioStatsDump() {
+	if (audioStatsDumpSeconds <= 0.0f) {
+		return;
+	}
 
-	duk_push_c_function(ctx, bitsyColor, 4);
-	duk_put_prop_string(ctx, bitsySystemIdx, "color");
+	Uint32 time = SDL_GetTicks();
 
-	duk_push_c_function(ctx, bitsyTile, 0);
-	duk_put_prop_string(ctx, bitsySystemIdx, "tile");
+	if (audioStatsPrevDumpTime == 0) {
+		audioStatsPrevDumpTime = time;
+		return;
+	}
 
-	duk_push_c_function(ctx, bitsyDelete, 1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "delete");
+	if ((time - audioStatsPrevDumpTime) < (Uint32) (audioStatsDumpSeconds * 1000)) {
+		return;
+	}
 
-	duk_push_c_function(ctx, bitsyFill, 2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "fill");
+	audioStatsPrevDumpTime = time;
 
-	duk_push_c_function(ctx, bitsySet, 3);
-	duk_put_prop_string(ctx, bitsySystemIdx, "set");
+	AudioStats period;
+	readAudioStats(NULL, &period, 1);
 
-	duk_push_c_function(ctx, bitsyTextbox, DUK_VARARGS);
-	duk_put_prop_string(ctx, bitsySystemIdx, "textbox");
+	if (audioStatsFilePath[0] != '\0' && audioStatsFile == NULL) {
+		audioStatsFile = fopen(audioStatsFilePath, "w");
 
-	// SOUND
+		if (audioStatsFile == NULL) {
+			printf("Error writing %s\n", audioStatsFilePath);
+			audioStatsFilePath[0] = '\0';
+		}
+		else {
+			fprintf(
+				audioStatsFile,
+				"time_ms,callbacks,duration_avg,duration_min,duration_max,interval_avg,interval_min,interval_max,"
+				"jitter,underruns,slow_callbacks,queue_depth_max,scheduled_max,dropped_total\n");
+		}
+	}
 
-	duk_push_c_function(ctx, bitsySound, DUK_VARARGS);
-	duk_put_prop_string(ctx, bitsySystemIdx, "sound");
+	if (audioStatsFile != NULL) {
+		writeAudioStatsRow(audioStatsFile, time, &period);
+	}
+	else {
+		printf("[audio stats @ %u ms]\n", time);
+		printAudioStats(&period);
+	}
+}
 
-	duk_push_c_function(ctx, bitsyFrequency, 2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "frequency");
+/* # FILE LOADING */
 
-	duk_push_c_function(ctx, bitsyVolume, 2);
-	duk_put_prop_string(ctx, bitsySystemIdx, "volume");
+char gameFilePath[256];
+int gameCount = 0;
 
-	// EVENTS
+int loadScript(duk_context* ctx, char* filepath) {
+	int success = 0;
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	printf("Loading %s ...\n", filepath);
+
+	char* fileBuffer = 0;
+	long length;
+	FILE* f = fopen(filepath, "r");
+
+	if (f) {
+		fseek(f, 0, SEEK_END);
+
+		length = ftell(f);
+
+		fseek(f, 0, SEEK_SET);
+
+		// length +1 to make sure there's room for null terminator
+		fileBuffer = malloc(length + 1);
+
+		if (fileBuffer) {
+			// replace seek length with read length
+			length = fread(fileBuffer, 1, length, f);
+
+			// ensure null terminator
+			fileBuffer[length] = '\0';
+		}
+
+		fclose(f);
+	}
+
+	if (fileBuffer) {
+		duk_push_lstring(ctx, (const char *) fileBuffer, (duk_size_t) length);
+
+		free(fileBuffer);
+
+		if (duk_peval(ctx) != 0) {
+			printf("Load Script Error: %s\n", duk_safe_to_string(ctx, -1));
+		}
+		else {
+			success = 1;
+		}
+
+		duk_pop(ctx);
+	}
+
+	traceSpanDetail("file", "load script", startTime, SDL_GetPerformanceCounter(), filepath);
+
+	return success;
+}
+
+int loadFile(duk_context* ctx, char* filepath, char* variableName) {
+	int success = 0;
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	printf("Loading %s ...\n", filepath);
+
+	char* fileBuffer = 0;
+	long length;
+	FILE* f = fopen(filepath, "r");
+
+	if (f) {
+		fseek(f, 0, SEEK_END);
+
+		length = ftell(f);
+
+		fseek(f, 0, SEEK_SET);
+
+		// length +1 to make sure there's room for null terminator
+		fileBuffer = malloc(length + 1);
+
+		if (fileBuffer) {
+			// replace seek length with read length
+			length = fread(fileBuffer, 1, length, f);
+
+			// ensure null terminator
+			fileBuffer[length] = '\0';
+		}
+
+		fclose(f);
+	}
+
+	if (fileBuffer) {
+		duk_push_lstring(ctx, (const char *) fileBuffer, (duk_size_t) length);
+		duk_put_global_string(ctx, variableName);
+		free(fileBuffer);
+		success = 1;
+	}
+
+	traceSpanDetail("file", "load file", startTime, SDL_GetPerformanceCounter(), filepath);
+
+	return success;
+}
+
+int loadEmbeddedScript(duk_context* ctx, char* fileStr) {
+	int success = 1;
+
+	if (duk_peval_string(ctx, fileStr) != 0) {
+		printf("Load Embedded Script Error: %s\n", duk_safe_to_string(ctx, -1));
+		success = 0;
+	}
+	duk_pop(ctx);
+
+	return success;
+}
+
+int loadEmbeddedFile(duk_context* ctx, char* fileStr, char* variableName) {
+	duk_push_string(ctx, fileStr);
+	duk_put_global_string(ctx, variableName);
+
+	return 1;
+}
+
+int loadEmbeddedBuffer(duk_context* ctx, unsigned char* bytes, unsigned int size, char* variableName) {
+	// copy the bytes into a Uint8Array
+	void* buffer = duk_push_fixed_buffer(ctx, size);
+	memcpy(buffer, bytes, size);
+	duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_UINT8ARRAY);
+	duk_put_global_string(ctx, variableName);
+	duk_pop(ctx);
+
+	return 1;
+}
+
+/* # WORLD CACHE */
+
+// the cache key includes this string, so changing it invalidates every cached world
+// (update it whenever the layout of the cached data changes - the engine is part of the key already)
+#define WORLD_CACHE_VERSION "bitsybox v0.2-8.12 world cache 2"
+#define WORLD_CACHE_DIR "cache"
+#define WORLD_CACHE_EXTENSION "bitsycache"
+
+// turned off by `--bench` so every run parses the world the same way. debug builds load the
+// engine from disk where it can change between runs without changing the cache key, so they
+// never use the cache
+#ifdef BUILD_DEBUG
+int isWorldCacheEnabled = 0;
+#else
+int isWorldCacheEnabled = 1;
+#endif
+
+typedef struct WorldCacheHeader {
+	char magic[4]; // always "BBXC"
+	uint32_t size; // size of the CBOR encoded world that follows the header (in bytes)
+	uint64_t key; // hash of the cache version + engine sources + game data
+} WorldCacheHeader;
+
+// 64-bit FNV-1a hash
+#define HASH_SEED 0xcbf29ce484222325ULL
+
+uint64_t hashBytes(uint64_t hash, const uint8_t* bytes, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+uint64_t worldCacheKey(duk_context* ctx) {
+	uint64_t key = hashBytes(HASH_SEED, (const uint8_t*) WORLD_CACHE_VERSION, strlen(WORLD_CACHE_VERSION));
+
+#ifndef BUILD_DEBUG
+	// a world parsed by a different engine is never read back, even if the version wasn't updated
+	char* engineSources[] = { world_js, sound_js, font_js, transition_js, script_js, dialog_js, renderer_js, bitsy_js, };
+	for (size_t i = 0; i < sizeof(engineSources) / sizeof(engineSources[0]); i++) {
+		key = hashBytes(key, (const uint8_t*) engineSources[i], strlen(engineSources[i]));
+	}
+#endif
+
+	duk_size_t length = 0;
+	duk_get_global_string(ctx, "__bitsybox_game_data__");
+	const char* gameData = duk_get_lstring(ctx, -1, &length);
+	if (gameData != NULL) {
+		key = hashBytes(key, (const uint8_t*) gameData, length);
+	}
+	duk_pop(ctx);
+
+	return key;
+}
+
+void worldCachePath(char* path, uint64_t key) {
+	sprintf(path, "%s/%016" PRIx64 ".%s", WORLD_CACHE_DIR, key, WORLD_CACHE_EXTENSION);
+}
+
+typedef struct WorldCacheRead {
+	FILE* file;
+	uint32_t size;
+} WorldCacheRead;
+
+// reads and decodes the world after the header (in a protected call, since it allocates in the VM)
+static duk_ret_t decodeWorldCache(duk_context* ctx, void* udata) {
+	WorldCacheRead* read = (WorldCacheRead*) udata;
+	void* cacheBuffer = duk_push_fixed_buffer(ctx, read->size);
+
+	if (fread(cacheBuffer, 1, read->size, read->file) != read->size) {
+		return duk_error(ctx, DUK_ERR_ERROR, "the cache file is truncated");
+	}
+
+	duk_cbor_decode(ctx, -1, 0);
+
+	return 1;
+}
+
+// the bytes left in `f` after the current position
+long remainingFileLength(FILE* f) {
+	long position = ftell(f);
+	fseek(f, 0, SEEK_END);
+	long length = ftell(f);
+	fseek(f, position, SEEK_SET);
+
+	return (position >= 0 && length >= position) ? length - position : 0;
+}
+
+int readWorldCache(duk_context* ctx) {
+	int success = 0;
+
+	if (!isWorldCacheEnabled) {
+		return success;
+	}
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+	uint64_t key = worldCacheKey(ctx);
+	char path[PATH_MAX];
+	worldCachePath(path, key);
+
+	FILE* f = fopen(path, "rb");
+
+	if (f) {
+		WorldCacheHeader header;
+
+		// a size past the end of the file means it was truncated (or corrupted) - ignore it and re-parse the world
+		if (fread(&header, sizeof(header), 1, f) == 1
+			&& memcmp(header.magic, "BBXC", 4) == 0
+			&& header.key == key
+			&& header.size <= remainingFileLength(f)) {
+			WorldCacheRead read = { .file = f, .size = header.size, };
+
+			if (duk_safe_call(ctx, decodeWorldCache, &read, 0, 1) == DUK_EXEC_SUCCESS) {
+				printf("Loading %s ...\n", path);
+				success = 1;
+			}
+			else {
+				printf("World Cache Error: %s\n", duk_safe_to_string(ctx, -1));
+				duk_pop(ctx);
+			}
+		}
+
+		fclose(f);
+	}
+
+	traceSpanDetail("file", "read world cache", startTime, SDL_GetPerformanceCounter(), path);
+
+	return success;
+}
+
+int writeWorldCache(duk_context* ctx, duk_idx_t idx) {
+	int success = 0;
+
+	if (!isWorldCacheEnabled) {
+		return success;
+	}
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+	uint64_t key = worldCacheKey(ctx);
+	char path[PATH_MAX];
+	worldCachePath(path, key);
+
+#ifdef PLATFORM_WIN
+	mkdir(WORLD_CACHE_DIR);
+#else
+	mkdir(WORLD_CACHE_DIR, 0755);
+#endif
+
+	duk_dup(ctx, idx);
+	duk_cbor_encode(ctx, -1, 0);
+
+	duk_size_t size = 0;
+	void* cacheBuffer = duk_get_buffer_data(ctx, -1, &size);
+
+	// the cache is written to a temporary file and renamed into place, so a crash (or another
+	// bitsybox running the same game) never leaves a half-written cache where it would be read
+	char tempPath[PATH_MAX + 32];
+	snprintf(tempPath, sizeof(tempPath), "%s.%d.tmp", path, (int) getpid());
+
+	FILE* f = fopen(tempPath, "wb");
+
+	if (f) {
+		WorldCacheHeader header = { .size = size, .key = key, };
+		memcpy(header.magic, "BBXC", 4);
+
+		success = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(cacheBuffer, 1, size, f) == size;
+		success = (fclose(f) == 0) && success;
+
+#ifdef PLATFORM_WIN
+		// rename doesn't replace an existing file on windows (this one couldn't be read anyway)
+		if (success) {
+			remove(path);
+		}
+#endif
+
+		success = success && rename(tempPath, path) == 0;
+
+		if (success) {
+			printf("Saving %s ...\n", path);
+		}
+		else {
+			remove(tempPath);
+		}
+	}
+
+	duk_pop(ctx);
+
+	traceSpanDetail("file", "write world cache", startTime, SDL_GetPerformanceCounter(), path);
+
+	return success;
+}
+
+/* # MEMORY STATS */
+
+// what bitsybox is holding on to, to find leaks and growth on machines that run for days
+typedef struct MemoryStats {
+	int blockCount; // memory blocks in use
+	uint64_t blockBytes;
+	int textureCount;
+	int textureBytes; // estimated
+	uint64_t heapBytes; // held by the javascript VM
+	uint64_t heapAllocCount; // live allocations (objects, strings, buffers, etc)
+	int tileCount; // live tiles
+	uint64_t tileCreateCount;
+	uint64_t tileDeleteCount;
+} MemoryStats;
+
+// periodic dumps (turned on with `--memory-stats`)
+float memoryStatsDumpSeconds = 0.0f;
+char memoryStatsFilePath[PATH_MAX] = "";
+FILE* memoryStatsFile = NULL;
+Uint32 memoryStatsPrevDumpTime = 0;
+
+void readMemoryStats(duk_context* ctx, MemoryStats* stats) {
+	memset(stats, 0, sizeof(MemoryStats));
+
+	for (int i = 0; i < MEMORY_BLOCK_MAX; i++) {
+		if (!isMemoryBlockEmpty(i)) {
+			stats->blockCount++;
+			stats->blockBytes += curSystem->memory[i].size;
+		}
+	}
+
+	stats->textureCount = SDL_AtomicGet(&textureCount);
+	stats->textureBytes = SDL_AtomicGet(&textureBytes);
+	stats->heapBytes = getHeapStats(ctx)->bytes;
+	stats->heapAllocCount = getHeapStats(ctx)->liveAllocCount;
+	stats->tileCount = curSystem->tileCount;
+	stats->tileCreateCount = curSystem->tileCreateCount;
+	stats->tileDeleteCount = curSystem->tileDeleteCount;
+}
+
+void printMemoryStats(MemoryStats* stats) {
+	printf(
+		"Memory: %d blocks (%" PRIu64 " bytes), %d textures (~%d bytes), javascript heap %" PRIu64 " bytes in %" PRIu64 " allocations\n",
+		stats->blockCount,
+		stats->blockBytes,
+		stats->textureCount,
+		stats->textureBytes,
+		stats->heapBytes,
+		stats->heapAllocCount);
+
+	printf(
+		"Tiles: %d live (%" PRIu64 " created, %" PRIu64 " deleted)\n",
+		stats->tileCount,
+		stats->tileCreateCount,
+		stats->tileDeleteCount);
+}
+
+void writeMemoryStatsRow(FILE* f, Uint32 time, MemoryStats* stats) {
+	fprintf(
+		f,
+		"%u,%d,%" PRIu64 ",%d,%d,%" PRIu64 ",%" PRIu64 ",%d,%" PRIu64 ",%" PRIu64 "\n",
+		time,
+		stats->blockCount,
+		stats->blockBytes,
+		stats->textureCount,
+		stats->textureBytes,
+		stats->heapBytes,
+		stats->heapAllocCount,
+		stats->tileCount,
+		stats->tileCreateCount,
+		stats->tileDeleteCount);
+	fflush(f);
+}
+
+// called from the game loop (while the engine isn't running): dumps the stats every `--memory-stats` seconds
+void updateMemoryStatsDump(duk_context* ctx) {
+	if (memoryStatsDumpSeconds <= 0.0f) {
+		return;
+	}
+
+	Uint32 time = SDL_GetTicks();
+
+	if (memoryStatsPrevDumpTime != 0 && (time - memoryStatsPrevDumpTime) < (Uint32) (memoryStatsDumpSeconds * 1000)) {
+		return;
+	}
+
+	memoryStatsPrevDumpTime = time;
+
+	MemoryStats stats;
+	readMemoryStats(ctx, &stats);
+
+	if (memoryStatsFilePath[0] != '\0' && memoryStatsFile == NULL) {
+		memoryStatsFile = fopen(memoryStatsFilePath, "w");
+
+		if (memoryStatsFile == NULL) {
+			printf("Error writing %s\n", memoryStatsFilePath);
+			memoryStatsFilePath[0] = '\0';
+		}
+		else {
+			fprintf(
+				memoryStatsFile,
+				"time_ms,blocks,block_bytes,textures,texture_bytes,heap_bytes,heap_allocations,"
+				"tiles,tiles_created,tiles_deleted\n");
+		}
+	}
+
+	if (memoryStatsFile != NULL) {
+		writeMemoryStatsRow(memoryStatsFile, time, &stats);
+	}
+	else {
+		printf("[memory stats @ %u ms]\n", time);
+		printMemoryStats(&stats);
+	}
+}
+
+/* # BITSY SYSTEM API IMPLEMENTATION */
+
+/* ## CONSTANTS */
+
+// memory blocks
+#define BITSY_VIDEO 0
+#define BITSY_TEXTBOX 1
+#define BITSY_MAP1 2
+#define BITSY_MAP2 3
+#define BITSY_SOUND1 4
+#define BITSY_SOUND2 5
+#define BITSY_SOUND3 6
+#define BITSY_SOUND4 7
+#define BITSY_SOUND5 8
+#define BITSY_SOUND6 9
+#define BITSY_SOUND7 10
+#define BITSY_SOUND8 11
+
+#define BITSY_TILE_START 12
+
+// any free sound channel
+#define BITSY_SOUND_ANY -1
+
+// graphics modes
+#define BITSY_GFX_VIDEO 0
+#define BITSY_GFX_MAP 1
+
+// text modes
+#define BITSY_TXT_HIREZ 0
+#define BITSY_TXT_LOREZ 1
+
+// size
+#define BITSY_TILE_SIZE 8
+#define BITSY_MAP_SIZE 16
+#define BITSY_VIDEO_SIZE 128
+#define BITSY_TEXTBOX_SIZE_MAX (BITSY_VIDEO_SIZE * 2) // in either dimension (at the hi-res scale)
+
+// button codes
+#define BITSY_BTN_UP 0
+#define BITSY_BTN_DOWN 1
+#define BITSY_BTN_LEFT 2
+#define BITSY_BTN_RIGHT 3
+#define BITSY_BTN_OK 4
+#define BITSY_BTN_MENU 5
+
+// pulse waves
+#define BITSY_PULSE_1_8 0
+#define BITSY_PULSE_1_4 1
+#define BITSY_PULSE_1_2 2
+
+/* ## IO */
+
+/* `bitsy.log(message, level, category)`
+ *
+ * Writes the string `message` to the debug console. The optional `level` is `bitsy.LOG_ERROR`, `bitsy.LOG_WARN`,
+ * `bitsy.LOG_INFO` (the default), `bitsy.LOG_DEBUG` or `bitsy.LOG_TRACE`, and the optional `category` is a short
+ * name like "renderer" (the default is "bitsy"). Messages above `--log-level` or outside `--log-categories` are
+ * skipped before `message` is converted to a string, and `bitsy.LOG_LEVEL` is the level that's logged (or -1),
+ * so scripts can skip building messages that won't be logged too.
+ */
+duk_ret_t bitsyLog(duk_context* ctx) {
+#ifdef ENABLE_BITSY_LOG
+	int level = duk_get_int_default(ctx, 1, LOG_INFO);
+	const char* category = duk_get_string_default(ctx, 2, "bitsy");
+
+	if (!isLogged(level, category)) {
+		return 0;
+	}
+
+	pushLogMessage(level, category, duk_safe_to_string(ctx, 0));
+#endif
+
+	return 0;
+}
+
+/* `Math.random()`
+ *
+ * Replaces the javascript VM's own generator with a seeded one (SplitMix64) so that recorded sessions replay exactly.
+ */
+duk_ret_t mathRandom(duk_context* ctx) {
+	curSystem->randomState += 0x9E3779B97F4A7C15ull;
+	uint64_t z = curSystem->randomState;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	z = z ^ (z >> 31);
+
+	// top 53 bits as a double in [0, 1)
+	duk_push_number(ctx, (double) (z >> 11) / 9007199254740992.0);
+
+	return 1;
+}
+
+/* `bitsy.button(code)`
+ *
+ * Returns `true` if the button referred to by `code` is held down. Otherwise it returns `false`.
+ */
+duk_ret_t bitsyButton(duk_context* ctx) {
+	int buttonCode = duk_get_int(ctx, 0);
+
+	int isAnyAlt = (isButtonLAlt || isButtonRAlt);
+	int isAnyCtrl = (isButtonLCtrl || isButtonRCtrl);
+	int isCtrlPlusR = isAnyCtrl && isButtonR;
+	int isPadFaceButton = isButtonPadA || isButtonPadB || isButtonPadX || isButtonPadY;
+
+	int isDown = 0;
+
+	if (curSystem->isInputScripted) {
+		isDown = buttonCode >= 0 && buttonCode < 32 && (curSystem->scriptedButtons & (1u << buttonCode)) != 0;
+	}
+	else if (buttonCode == 0) {
+		isDown = isButtonUp || isButtonW || isButtonPadUp;
+	}
+	else if (buttonCode == 1) {
+		isDown = isButtonDown || isButtonS || isButtonPadDown;
+	}
+	else if (buttonCode == 2) {
+		isDown = isButtonLeft || isButtonA || isButtonPadLeft;
+	}
+	else if (buttonCode == 3) {
+		isDown = isButtonRight || isButtonD || isButtonPadRight;
+	}
+	else if (buttonCode == 4) {
+		isDown = isButtonSpace || (isButtonReturn && !isAnyAlt) || isPadFaceButton;
+	}
+	else if (buttonCode == 5) {
+		isDown = isButtonEscape || isCtrlPlusR || isButtonPadStart;
+	}
+
+	if (isDown) {
+		traceInputRead();
+	}
+
+	duk_push_boolean(ctx, isDown);
+
+	return 1;
+}
+
+/* `bitsy.getGameData()`
+ * 
+ * Returns the game data as a string.
+ */
+duk_ret_t bitsyGetGameData(duk_context* ctx) {
+	duk_peval_string(ctx, "__bitsybox_game_data__");
+
+	return 1;
+}
+
+/* `bitsy.getFontData()`
+ *
+ * Returns the default font data, either as a string in the .bitsyfont format,
+ * or (in release builds) as a Uint8Array containing a prebaked glyph table.
+ */
+duk_ret_t bitsyGetFontData(duk_context* ctx) {
+	duk_peval_string(ctx, "__bitsybox_default_font__");
+
+	return 1;
+}
+
+/* `bitsy.getWorldCache()`
+ *
+ * Returns the world that was cached for the current game data by `bitsy.putWorldCache()`
+ * (possibly during a previous launch), or `undefined` if there isn't one.
+ */
+duk_ret_t bitsyGetWorldCache(duk_context* ctx) {
+	return readWorldCache(ctx) ? 1 : 0;
+}
+
+/* `bitsy.putWorldCache(world)`
+ *
+ * Stores the parsed `world` in the cache directory, keyed by the current game data.
+ * Only plain data can be stored (objects, arrays, strings, numbers, booleans, and byte arrays).
+ * Returns `true` if the world was cached.
+ */
+duk_ret_t bitsyPutWorldCache(duk_context* ctx) {
+	duk_push_boolean(ctx, writeWorldCache(ctx, 0));
+
+	return 1;
+}
+
+/* ## GRAPHICS */
+
+/* `bitsy.graphicsMode(mode)`
+ *
+ * Sets the current graphics display `mode`, and also returns the current graphics mode.
+ * If no mode input is given, just returns the current mode without changing it.
+ */
+duk_ret_t bitsyGraphicsMode(duk_context* ctx) {
+	// set the graphics mode if there is an input mode
+	if (duk_get_top(ctx) >= 1) {
+		int prevGraphicsMode = curSystem->graphicsMode;
+		curSystem->graphicsMode = duk_get_int(ctx, 0);
+
+		if (curSystem->graphicsMode != prevGraphicsMode) {
+			curSystem->shouldRenderTextures = 1;
+		}
+	}
+
+	// return the current graphics mode
+	duk_push_int(ctx, curSystem->graphicsMode);
+
+	return 1;
+}
+
+/* `bitsy.textMode(mode)`
+ *
+ * Sets the current text display `mode`, and also returns the current text mode.
+ * If no `mode` input is given, just returns the current mode without changing it.
+ */
+duk_ret_t bitsyTextMode(duk_context* ctx) {
+	// set the text mode if there is an input mode
+	if (duk_get_top(ctx) >= 1) {
+		int prevTextMode =  curSystem->textMode;
+		curSystem->textMode = duk_get_int(ctx, 0);
+
+		// update the textbox render scale
+		curSystem->textboxRenderScale = (curSystem->textMode == BITSY_TXT_LOREZ) ? 4 : 2;
+
+		if (curSystem->textMode != prevTextMode) {
+			curSystem->shouldRenderTextures = 1;
+		}
+	}
+
+	// return the current text mode
+	duk_push_int(ctx, curSystem->textMode);
+
+	return 1;
+}
+
+/* `bitsy.color(color, r, g, b)`
+ *
+ * Sets the color in the system palette at index `color` to a color defined by the color parameters 
+ * `r` (red), `g` (green), and `b` (blue). These values must be between 0 and 255. 
+ * (For example, `bitsy.color(2, 0, 0, 0)` sets the color at index 2 to black and 
+ * `bitsy.color(2, 255, 255, 255)` set the color at the same index to white.)
+ */
+duk_ret_t bitsyColor(duk_context* ctx) {
+	int paletteIndex = duk_get_int(ctx, 0);
+	int r = duk_get_int(ctx, 1);
+	int g = duk_get_int(ctx, 2);
+	int b = duk_get_int(ctx, 3);
+
+	if (paletteIndex < 0 || paletteIndex >= PALETTE_MAX) {
+		return 0;
+	}
+
+	curSystem->palette[paletteIndex] = (Color) { r, g, b };
+
+	// printf("bitsyColor %i - %i %i %i\n", paletteIndex, r, g, b);
+
+	curSystem->shouldRenderTextures = 1;
+
+	return 0;
+}
+
+/* `bitsy.tile()`
+ *
+ * Allocates a new tile and returns its memory block location.
+ */
+duk_ret_t bitsyTile(duk_context* ctx) {
+	// search the tile memory for an empty block (the renderer creates its texture)
+	int tileIndex = BITSY_TILE_START;
+	while (tileIndex < TEXTURE_MAX && !isMemoryBlockEmpty(tileIndex)) {
+		tileIndex++;
+	}
+
+	// return nothing if there is no available space
+	if (tileIndex >= TEXTURE_MAX) {
+		return 0;
+	}
+
+	allocateMemoryBlock(tileIndex, BITSY_TILE_SIZE * BITSY_TILE_SIZE);
+	curSystem->shouldRenderTextures = 1;
+	curSystem->tileCount++;
+	curSystem->tileCreateCount++;
+
+	duk_push_int(ctx, tileIndex);
+
+	return 1;
+}
+
+/* `bitsy.delete(tile)`
+ *
+ * Deletes the tile at the specified memory block location.
+ */
+duk_ret_t bitsyDelete(duk_context* ctx) {
+	int tile = duk_get_int(ctx, 0);
+	if (tile >= BITSY_TILE_START && tile < TEXTURE_MAX && !isMemoryBlockEmpty(tile)) {
+		logMessage(LOG_DEBUG, "bitsybox", "BITSY DELETE %i", tile);
+
+		// free the associated system memory (the renderer destroys the texture)
+		freeMemoryBlock(tile);
+		curSystem->tileCount--;
+		curSystem->tileDeleteCount++;
+	}
+
+	return 0;
+}
+
+/* `bitsy.fill(block, value)`
+ *
+ * Fills an entire memory `block` with a number `value`. 
+ * Can be used to clear blocks such as video memory, tilemap memory, and tile memory.
+ */
+duk_ret_t bitsyFill(duk_context* ctx) {
+	int block = duk_get_int(ctx, 0);
+	int value = duk_get_int(ctx, 1);
+
+	// verify valid block
+	if (isMemoryBlockValid(block)) {
+		// verify valid data
+		if (value >= 0 && value < 256) {
+			// everything is ok - set the data!
+			for (int i = 0; i < curSystem->memory[block].size; i++) {
+				curSystem->memory[block].data[i] = value;
+			}
+
+			curSystem->shouldRenderTextures = 1;
+			traceInputWrite();
+		}
+	}
+
+	return 0;
+}
+
+/* `bitsy.set(block, index, value)`
+ *
+ * Sets the value at `index` within a memory `block` with a number `value`.
+ */
+duk_ret_t bitsySet(duk_context* ctx) {
+	int block = duk_get_int(ctx, 0);
+	int index = duk_get_int(ctx, 1);
+	int value = duk_get_int(ctx, 2);
+
+	// printf("BITSY SET %i %i %i - GFX %i\n", block, index, value, curSystem->graphicsMode);
+
+	// verify valid block
+	if (isMemoryBlockValid(block)) {
+		// verify valid location in block
+		if (index >= 0 && index < curSystem->memory[block].size) {
+			// verify valid data
+			if (value >= 0 && value < 256) {
+				// everything is ok - set the data!
+				curSystem->memory[block].data[index] = value;
+
+				curSystem->shouldRenderTextures = 1;
+				traceInputWrite();
+			}
+		}
+	}
+
+	return 0;
+}
+
+/* `bitsy.textbox(visible, x, y, w, h)`
+ *
+ * Updates the textbox display settings.
+ * If `visible` is `true` the textbox is rendered, otherwise it's hidden.
+ * The textbox's position (relative the main display's coordinate space)
+ * is defined by `x` and `y`. And the size of the textbox
+ * (in its internal resolution) is defined by `w` (width) and `h` (height).
+ * Omitted parameters are unchanged (For example, you can just reveal
+ * the textbox without changing its position and size using `bitsy.textbox(true)`).
+ */
+duk_ret_t bitsyTextbox(duk_context* ctx) {
+	if (duk_get_top(ctx) >= 1) {
+		curSystem->isTextboxVisible = duk_get_boolean(ctx, 0);
+	}
+
+	if (duk_get_top(ctx) >= 3) {
+		curSystem->textboxX = duk_get_int(ctx, 1);
+		curSystem->textboxY = duk_get_int(ctx, 2);
+	}
+
+	if (duk_get_top(ctx) >= 5) {
+		int width = duk_get_int(ctx, 3);
+		int height = duk_get_int(ctx, 4);
+
+		// (the size is clamped so the memory block can't be negative or enormous)
+		curSystem->textboxWidth = width < 0 ? 0 : (width > BITSY_TEXTBOX_SIZE_MAX ? BITSY_TEXTBOX_SIZE_MAX : width);
+		curSystem->textboxHeight = height < 0 ? 0 : (height > BITSY_TEXTBOX_SIZE_MAX ? BITSY_TEXTBOX_SIZE_MAX : height);
+
+		// the renderer replaces the texture when the size changes
+		allocateMemoryBlock(BITSY_TEXTBOX, curSystem->textboxWidth * curSystem->textboxHeight);
+		curSystem->shouldRenderTextures = 1;
+	}
+
+	return 0;
+}
+
+/* ## SOUND */
+
+int soundChannelIndex(int channel) {
+	if (channel == BITSY_SOUND_ANY) {
+		return SOUND_CHANNEL_ANY;
+	}
+	else if (channel >= BITSY_SOUND1 && channel <= BITSY_SOUND8) {
+		return channel - BITSY_SOUND1;
+	}
+
+	return -1;
+}
+
+// voice settings for sounds played on `bitsy.SOUND_ANY`
+float anyChannelPan = 0.0f;
+int anyChannelPriority = 0;
+
+float pulseDutyCycle(int pulse) {
+	switch (pulse) {
+		case BITSY_PULSE_1_8:
+			return (1.0f / 8.0f);
+		case BITSY_PULSE_1_4:
+			return (1.0f / 4.0f);
+		default:
+			return (1.0f / 2.0f);
+	}
+}
+
+int millisecondsToSamples(float ms) {
+	return floor((ms / 1000.0f) * audioSampleRate);
+}
+
+// audio step for a command that should play `delay` milliseconds after the next buffer starts
+Uint32 audioCommandTime(float delay) {
+	return (Uint32) SDL_AtomicGet(&audioClock) + (delay > 0 ? millisecondsToSamples(delay) : 0);
+}
+
+/* `bitsy.sound(channel, duration, frequency, volume, pulse, delay)`
+ *
+ * Updates all audio settings for one sound `channel` (`bitsy.SOUND1` to `bitsy.SOUND8`, or `bitsy.SOUND_ANY`
+ * to play it on whichever pooled voice is free). The `duration` is in milliseconds, `frequency` is in decihertz (dHz), `volume` must be between 0 and 15,
+ * and `pulse` is one of the pulse wave constants. An optional `delay` (in milliseconds) schedules
+ * the sound to start that much later, measured from the start of the next audio buffer.
+ */
+duk_ret_t bitsySound(duk_context* ctx) {
+	// a muted system (like a `--validate` game) leaves the audio state it shares with other threads alone
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	int argCount = duk_get_top(ctx);
+
+	if (argCount >= 1) {
+		int channel = soundChannelIndex(duk_get_int(ctx, 0));
+
+		if (channel < 0) {
+			return 0;
+		}
+
+		AudioCommand command = {
+			.type = AUDIO_SOUND,
+			.time = audioCommandTime(argCount >= 6 ? duk_get_number(ctx, 5) : 0),
+			.channel = channel,
+			.flags = 0,
+			.frequency = 0.0f,
+			.pan = anyChannelPan,
+			.priority = anyChannelPriority,
+		};
+
+		if (argCount >= 2) {
+			// duration is passed in as milliseconds, but here we convert it
+			// to samples since that is easier to sync with the SDL audio system
+			command.flags |= AUDIO_SET_DURATION;
+			command.duration = millisecondsToSamples(duk_get_int(ctx, 1));
+		}
+
+		if (argCount >= 3) {
+			command.frequency = duk_get_int(ctx, 2) / 100.0f;
+		}
+
+		if (argCount >= 4) {
+			command.flags |= AUDIO_SET_VOLUME;
+			command.volume = duk_get_int(ctx, 3) / 15.0f;
+		}
+
+		if (argCount >= 5) {
+			command.flags |= AUDIO_SET_PULSE;
+			command.dutyCycle = pulseDutyCycle(duk_get_int(ctx, 4));
+		}
+
+		pushAudioCommand(&command);
+	}
+
+	return 0;
+}
+
+/* `bitsy.frequency(channel, frequency)`
+ *
+ * Sets the `frequency` for one sound `channel`. Units are decihertz (dHz).
+ */
+duk_ret_t bitsyFrequency(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	int channel = soundChannelIndex(duk_get_int(ctx, 0));
+
+	if (channel >= 0 && channel < SOUND_CHANNEL_COUNT) {
+		AudioCommand command = {
+			.type = AUDIO_FREQUENCY,
+			.time = audioCommandTime(0),
+			.channel = channel,
+			.frequency = duk_get_int(ctx, 1) / 100.0f,
+		};
+
+		pushAudioCommand(&command);
+	}
+
+	return 0;
+}
+
+/* `bitsy.volume(channel, volume)`
+ *
+ * Sets the `volume` for one sound `channel`. Volume must be between 0 and 15 (inclusive).
+ */
+duk_ret_t bitsyVolume(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	int channel = soundChannelIndex(duk_get_int(ctx, 0));
+
+	if (channel >= 0 && channel < SOUND_CHANNEL_COUNT) {
+		AudioCommand command = {
+			.type = AUDIO_VOLUME,
+			.time = audioCommandTime(0),
+			.channel = channel,
+			.volume = duk_get_int(ctx, 1) / 15.0f,
+		};
+
+		pushAudioCommand(&command);
+	}
+
+	return 0;
+}
+
+double getNumberProperty(duk_context* ctx, duk_idx_t idx, const char* key) {
+	duk_get_prop_string(ctx, idx, key);
+	double value = duk_get_number_default(ctx, -1, 0.0);
+	duk_pop(ctx);
+
+	return value;
+}
+
+/* `bitsy.blip(channel, blip)`
+ *
+ * Plays a sound effect on one sound `channel`. The audio system evaluates its volume envelope and pitch steps
+ * on every sample. The `blip` object has the envelope lengths `attack`, `decay`, `length` and `release`
+ * (in milliseconds), the volume levels `peak` and `sustain` (between 0 and 15), an array of `frequencies`
+ * in decihertz (dHz) stepped through every `stepTime` milliseconds after a `stepDelay`, whether to `repeat`
+ * those steps, and the `pulse` wave constant. Any other sound played on the channel cancels the blip.
+ * Like `bitsy.sound`, the `channel` can be `bitsy.SOUND_ANY`.
+ */
+duk_ret_t bitsyBlip(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	int channel = soundChannelIndex(duk_get_int(ctx, 0));
+
+	if (channel < 0 || !duk_is_object(ctx, 1)) {
+		return 0;
+	}
+
+	AudioCommand command = {
+		.type = AUDIO_BLIP,
+		.time = audioCommandTime(0),
+		.channel = channel,
+		.pan = anyChannelPan,
+		.priority = anyChannelPriority,
+	};
+
+	Envelope* envelope = &command.envelope;
+	envelope->attack = millisecondsToSamples(getNumberProperty(ctx, 1, "attack"));
+	envelope->decay = millisecondsToSamples(getNumberProperty(ctx, 1, "decay"));
+	envelope->length = millisecondsToSamples(getNumberProperty(ctx, 1, "length"));
+	envelope->release = millisecondsToSamples(getNumberProperty(ctx, 1, "release"));
+	envelope->peak = getNumberProperty(ctx, 1, "peak") / 15.0f;
+	envelope->sustain = getNumberProperty(ctx, 1, "sustain") / 15.0f;
+	envelope->stepDelay = millisecondsToSamples(getNumberProperty(ctx, 1, "stepDelay"));
+	envelope->stepTime = millisecondsToSamples(getNumberProperty(ctx, 1, "stepTime"));
+
+	duk_get_prop_string(ctx, 1, "repeat");
+	envelope->isRepeating = duk_to_boolean(ctx, -1);
+	duk_pop(ctx);
+
+	command.dutyCycle = pulseDutyCycle(getNumberProperty(ctx, 1, "pulse"));
+
+	// negative lengths would break the segment math
+	envelope->attack = envelope->attack > 0 ? envelope->attack : 0;
+	envelope->decay = envelope->decay > 0 ? envelope->decay : 0;
+	envelope->length = envelope->length > 0 ? envelope->length : 0;
+	envelope->release = envelope->release > 0 ? envelope->release : 0;
+
+	envelope->frequencyCount = 0;
+	envelope->frequencies[0] = 0.0f;
+
+	duk_get_prop_string(ctx, 1, "frequencies");
+	if (duk_is_array(ctx, -1)) {
+		int count = duk_get_length(ctx, -1);
+		for (int i = 0; i < count && i < ENVELOPE_STEP_MAX; i++) {
+			duk_get_prop_index(ctx, -1, i);
+			envelope->frequencies[i] = duk_get_int(ctx, -1) / 100.0f;
+			envelope->frequencyCount++;
+			duk_pop(ctx);
+		}
+	}
+	duk_pop(ctx);
+
+	pushAudioCommand(&command);
+
+	return 0;
+}
+
+/* `bitsy.voice(channel, pan, priority)`
+ *
+ * Sets the stereo `pan` of one sound `channel` (from -1.0 for left to 1.0 for right, centered by default)
+ * and its `priority`. Sounds on `bitsy.SOUND_ANY` only take over a busy voice if their priority is
+ * at least as high as its own. Calling this on `bitsy.SOUND_ANY` sets the pan and priority
+ * for all of the sounds played on it afterwards.
+ */
+duk_ret_t bitsyVoice(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	int channel = soundChannelIndex(duk_get_int(ctx, 0));
+	float pan = duk_get_number_default(ctx, 1, 0.0);
+	int priority = duk_get_int_default(ctx, 2, 0);
+
+	pan = pan < -1.0f ? -1.0f : (pan > 1.0f ? 1.0f : pan);
+
+	if (channel == SOUND_CHANNEL_ANY) {
+		anyChannelPan = pan;
+		anyChannelPriority = priority;
+	}
+	else if (channel >= 0) {
+		AudioCommand command = {
+			.type = AUDIO_VOICE,
+			.time = audioCommandTime(0),
+			.channel = channel,
+			.pan = pan,
+			.priority = priority,
+		};
+
+		pushAudioCommand(&command);
+	}
+
+	return 0;
+}
+
+void readTuneNotes(duk_context* ctx, duk_idx_t idx, TuneNote* notes, int stepCount) {
+	int noteCount = duk_is_array(ctx, idx) ? (duk_get_length(ctx, idx) / 2) : 0;
+
+	for (int i = 0; i < stepCount; i++) {
+		notes[i].frequency = 0.0f;
+		notes[i].beats = 0;
+
+		if (i < noteCount) {
+			duk_get_prop_index(ctx, idx, (i * 2) + 0);
+			notes[i].frequency = duk_get_int(ctx, -1) / 100.0f;
+			duk_pop(ctx);
+
+			duk_get_prop_index(ctx, idx, (i * 2) + 1);
+			notes[i].beats = duk_get_int(ctx, -1);
+			duk_pop(ctx);
+		}
+
+		// skip anything the audio callback can't play
+		if (notes[i].frequency <= 0.0f || notes[i].beats < 0) {
+			notes[i].beats = 0;
+		}
+	}
+}
+
+/* `bitsy.tune(melody, harmony, beatLength, pulseA, pulseB, volume)`
+ *
+ * Starts looping a tune using the system's sequencer, which keeps time on the audio thread.
+ * The `melody` plays on `bitsy.SOUND1` and the `harmony` on `bitsy.SOUND2`. Each is an array with two numbers
+ * per sixteenth note step: a frequency in decihertz (dHz) and a length in steps (zero for a rest).
+ * The `beatLength` of one step is in milliseconds, `pulseA` and `pulseB` are pulse wave constants,
+ * and `volume` must be between 0 and 15. The first step plays after one `beatLength` has passed.
+ */
+duk_ret_t bitsyTune(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	// find a slot the audio callback isn't waiting to read
+	int slot = -1;
+	for (int i = 0; i < TUNE_SLOT_COUNT && slot < 0; i++) {
+		if (!SDL_AtomicGet(&tuneSlotBusy[i])) {
+			slot = i;
+		}
+	}
+
+	if (slot < 0) {
+		printf("Tune Error: no free tune slots\n");
+		return 0;
+	}
+
+	TuneSequence* sequence = &tuneSlots[slot];
+
+	int melodyCount = duk_is_array(ctx, 0) ? (duk_get_length(ctx, 0) / 2) : 0;
+	int harmonyCount = duk_is_array(ctx, 1) ? (duk_get_length(ctx, 1) / 2) : 0;
+
+	sequence->stepCount = melodyCount > harmonyCount ? melodyCount : harmonyCount;
+	if (sequence->stepCount > TUNE_STEP_MAX) {
+		sequence->stepCount = TUNE_STEP_MAX;
+	}
+
+	sequence->stepLength = millisecondsToSamples(duk_get_number(ctx, 2));
+
+	if (sequence->stepCount <= 0 || sequence->stepLength <= 0) {
+		return 0;
+	}
+
+	readTuneNotes(ctx, 0, sequence->melody, sequence->stepCount);
+	readTuneNotes(ctx, 1, sequence->harmony, sequence->stepCount);
+
+	sequence->dutyCycleA = pulseDutyCycle(duk_get_int(ctx, 3));
+	sequence->dutyCycleB = pulseDutyCycle(duk_get_int(ctx, 4));
+	sequence->volume = duk_get_int(ctx, 5) / 15.0f;
+
+	AudioCommand command = {
+		.type = AUDIO_TUNE,
+		.time = audioCommandTime(0),
+		.value = slot,
+	};
+
+	SDL_AtomicSet(&tuneSlotBusy[slot], 1);
+	if (!pushAudioCommand(&command)) {
+		SDL_AtomicSet(&tuneSlotBusy[slot], 0);
+	}
+
+	return 0;
+}
+
+/* `bitsy.tuneStop()`
+ *
+ * Stops the tune started by `bitsy.tune`. Notes that are already playing finish normally.
+ */
+duk_ret_t bitsyTuneStop(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	AudioCommand command = {
+		.type = AUDIO_TUNE_STOP,
+		.time = audioCommandTime(0),
+	};
+
+	pushAudioCommand(&command);
+
+	return 0;
+}
+
+/* `bitsy.tunePause(paused)`
+ *
+ * Pauses or resumes the sequencer without losing its place in the tune.
+ */
+duk_ret_t bitsyTunePause(duk_context* ctx) {
+	if (curSystem->isAudioMuted) {
+		return 0;
+	}
+
+	AudioCommand command = {
+		.type = AUDIO_TUNE_PAUSE,
+		.time = audioCommandTime(0),
+		.value = duk_get_boolean(ctx, 0),
+	};
+
+	pushAudioCommand(&command);
+
+	return 0;
+}
+
+/* `bitsy.tuneBeat()`
+ *
+ * Returns the index of the last step the sequencer played (-1 if it hasn't played one yet, or isn't playing).
+ */
+duk_ret_t bitsyTuneBeat(duk_context* ctx) {
+	duk_push_int(ctx, curSystem->isAudioMuted ? -1 : SDL_AtomicGet(&tunePosition));
+
+	return 1;
+}
+
+void putNumberProperty(duk_context* ctx, duk_idx_t idx, const char* key, double value) {
+	duk_push_number(ctx, value);
+	duk_put_prop_string(ctx, idx, key);
+}
+
+/* `bitsy.audioStats()`
+ *
+ * Returns an object with the audio callback's performance since startup (times in milliseconds):
+ * `callbacks`, `durationAvg`, `durationMin`, `durationMax`, `intervalAvg`, `intervalMin`, `intervalMax`, `jitter`,
+ * `underruns` (callbacks that started too late), `slowCallbacks` (callbacks that took longer than the audio they made),
+ * `queueDepthMax`, `scheduledMax`, and `dropped` (commands lost to a full queue).
+ */
+duk_ret_t bitsyAudioStats(duk_context* ctx) {
+	AudioStats stats;
+	readAudioStats(&stats, NULL, 0);
+
+	duk_idx_t statsIdx = duk_push_object(ctx);
+	putNumberProperty(ctx, statsIdx, "callbacks", stats.callbackCount);
+	putNumberProperty(ctx, statsIdx, "durationAvg", stats.callbackCount > 0 ? stats.durationTotal / stats.callbackCount : 0.0);
+	putNumberProperty(ctx, statsIdx, "durationMin", stats.durationMin);
+	putNumberProperty(ctx, statsIdx, "durationMax", stats.durationMax);
+	putNumberProperty(ctx, statsIdx, "intervalAvg", stats.intervalCount > 0 ? stats.intervalTotal / stats.intervalCount : 0.0);
+	putNumberProperty(ctx, statsIdx, "intervalMin", stats.intervalMin);
+	putNumberProperty(ctx, statsIdx, "intervalMax", stats.intervalMax);
+	putNumberProperty(ctx, statsIdx, "jitter", audioStatsJitter(&stats));
+	putNumberProperty(ctx, statsIdx, "underruns", stats.underrunCount);
+	putNumberProperty(ctx, statsIdx, "slowCallbacks", stats.slowCallbackCount);
+	putNumberProperty(ctx, statsIdx, "queueDepthMax", stats.queueDepthMax);
+	putNumberProperty(ctx, statsIdx, "scheduledMax", stats.scheduledCommandMax);
+	putNumberProperty(ctx, statsIdx, "dropped", SDL_AtomicGet(&audioQueueDropCount));
+
+	return 1;
+}
+
+/* `bitsy.memoryStats()`
+ *
+ * Returns an object with what the system is holding on to: `blocks` and `blockBytes` (memory blocks in use),
+ * `textures` and `textureBytes` (an estimate of the video memory they use), `heapBytes` and `heapAllocations`
+ * (the javascript heap), and `tiles` (live tiles), `tilesCreated` and `tilesDeleted` (since startup).
+ */
+duk_ret_t bitsyMemoryStats(duk_context* ctx) {
+	MemoryStats stats;
+	readMemoryStats(ctx, &stats);
+
+	duk_idx_t statsIdx = duk_push_object(ctx);
+	putNumberProperty(ctx, statsIdx, "blocks", stats.blockCount);
+	putNumberProperty(ctx, statsIdx, "blockBytes", stats.blockBytes);
+	putNumberProperty(ctx, statsIdx, "textures", stats.textureCount);
+	putNumberProperty(ctx, statsIdx, "textureBytes", stats.textureBytes);
+	putNumberProperty(ctx, statsIdx, "heapBytes", stats.heapBytes);
+	putNumberProperty(ctx, statsIdx, "heapAllocations", stats.heapAllocCount);
+	putNumberProperty(ctx, statsIdx, "tiles", stats.tileCount);
+	putNumberProperty(ctx, statsIdx, "tilesCreated", stats.tileCreateCount);
+	putNumberProperty(ctx, statsIdx, "tilesDeleted", stats.tileDeleteCount);
+
+	return 1;
+}
+
+/* ## EVENTS */
+
+/* `bitsy.loop(fn)`
+ *
+ * The system will call function `fn` on every update loop. 
+ * It runs at a fixed 60 updates per second, and `fn` will also receive 
+ * an input parameter `dt` with the length of each update (1000 / 60 milliseconds).
+ */
+duk_ret_t bitsyLoop(duk_context* ctx) {
+	duk_put_global_string(ctx, "__bitsybox_on_update__");
+
+	return 0;
+}
+
+/* ## NATIVE CALL COUNTING */
+
+// when `isNativeCallCounting` is set (by `--bench`), a trace is running or `--call-stats` is on,
+// native functions are registered through a trampoline that counts (and times) their calls
+// (the function's "magic" number is its index in the table)
+#define NATIVE_FUNCTION_MAX 64
+
+typedef struct NativeFunction {
+	duk_c_function func;
+	const char* name;
+	uint64_t callCount;
+	Uint64 ticks; // time spent in the function (only with `--call-stats`)
+	int frameCallCount; // calls and time in the current frame
+	Uint64 frameTicks;
+	int maxFrameCallCount;
+} NativeFunction;
+
+NativeFunction nativeFunctions[NATIVE_FUNCTION_MAX];
+int nativeFunctionCount = 0;
+int isNativeCallCounting = 0;
+
+// with `--call-stats`, every native call is also timed and added up per frame, and with
+// `--call-stats-callers` it's attributed to the javascript function (and line) that made it
+#define NATIVE_CALLER_MAX 1024
+#define NATIVE_CALLER_NAME_MAX 48
+#define NATIVE_CALLER_TOP 20 // how many are printed
+
+typedef struct NativeCaller {
+	int functionIndex;
+	char name[NATIVE_CALLER_NAME_MAX];
+	int lineNumber;
+	uint64_t callCount; // 0 for an empty slot
+	Uint64 ticks;
+} NativeCaller;
+
+int isCallStatsEnabled = 0;
+int isCallerStatsEnabled = 0;
+char callStatsFilePath[PATH_MAX] = "";
+FILE* callStatsFile = NULL;
+int callStatsColumnCount = 0; // functions in the file's header
+int callStatsFrameCount = 0;
+
+NativeCaller nativeCallers[NATIVE_CALLER_MAX];
+int nativeCallerCount = 0;
+uint64_t nativeCallerDropCount = 0; // calls from callers that didn't fit in the table
+
+// looks up the javascript function that called native function `functionIndex`
+void recordNativeCaller(duk_context* ctx, int functionIndex, Uint64 ticks) {
+	char name[NATIVE_CALLER_NAME_MAX] = "(top level)";
+	int lineNumber = 0;
+
+	// the entry below the native function itself
+	duk_inspect_callstack_entry(ctx, -2);
+
+	if (duk_is_object(ctx, -1)) {
+		lineNumber = (int) getNumberProperty(ctx, -1, "lineNumber");
+
+		duk_get_prop_string(ctx, -1, "function");
+		duk_get_prop_string(ctx, -1, "name");
+		const char* functionName = duk_get_string(ctx, -1);
+		snprintf(name, sizeof(name), "%s", (functionName != NULL && functionName[0] != '\0') ? functionName : "(anonymous)");
+		duk_pop_2(ctx);
+	}
+
+	duk_pop(ctx);
+
+	uint32_t hash = (uint32_t) hashBytes((uint64_t) functionIndex * 31 + lineNumber, (const uint8_t*) name, strlen(name));
+	int slot = hash % NATIVE_CALLER_MAX;
+
+	for (int i = 0; i < NATIVE_CALLER_MAX; i++) {
+		NativeCaller* caller = &nativeCallers[(slot + i) % NATIVE_CALLER_MAX];
+
+		if (caller->callCount == 0) {
+			if (nativeCallerCount >= NATIVE_CALLER_MAX / 2) {
+				// keep the table fast to search
+				break;
+			}
+
+			*caller = (NativeCaller) { .functionIndex = functionIndex, .lineNumber = lineNumber, };
+			snprintf(caller->name, sizeof(caller->name), "%s", name);
+			nativeCallerCount++;
+		}
+
+		if (caller->functionIndex == functionIndex && caller->lineNumber == lineNumber && strcmp(caller->name, name) == 0) {
+			caller->callCount++;
+			caller->ticks += ticks;
+			return;
+		}
+	}
+
+	nativeCallerDropCount++;
+}
+
+duk_ret_t nativeCallTrampoline(duk_context* ctx) {
+	int functionIndex = duk_get_current_magic(ctx);
+	NativeFunction* nativeFunction = &nativeFunctions[functionIndex];
+	nativeFunction->callCount++;
+
+	if (!isTracing && !isCallStatsEnabled) {
+		return nativeFunction->func(ctx);
+	}
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+	duk_ret_t result = nativeFunction->func(ctx);
+	Uint64 endTime = SDL_GetPerformanceCounter();
+
+	traceSpan("native", nativeFunction->name, startTime, endTime);
+
+	if (isCallStatsEnabled) {
+		nativeFunction->frameCallCount++;
+		nativeFunction->frameTicks += endTime - startTime;
+	}
+
+	if (isCallerStatsEnabled) {
+		recordNativeCaller(ctx, functionIndex, endTime - startTime);
+	}
+
+	return result;
+}
+
+uint64_t nativeCallTotal() {
+	uint64_t callCount = 0;
+
+	for (int i = 0; i < nativeFunctionCount; i++) {
+		callCount += nativeFunctions[i].callCount;
+	}
+
+	return callCount;
+}
+
+void resetNativeCallCounts() {
+	for (int i = 0; i < nativeFunctionCount; i++) {
+		nativeFunctions[i].callCount = 0;
+	}
+}
+
+/* ## NATIVE CALL STATS */
+
+// called at the end of every frame: adds up the frame's calls, and writes them to `--call-stats-file`
+void endCallStatsFrame() {
+	if (!isCallStatsEnabled) {
+		return;
+	}
+
+	if (callStatsFilePath[0] != '\0' && callStatsFile == NULL) {
+		callStatsFile = fopen(callStatsFilePath, "w");
+
+		if (callStatsFile == NULL) {
+			printf("Error writing %s\n", callStatsFilePath);
+			callStatsFilePath[0] = '\0';
+		}
+		else {
+			fprintf(callStatsFile, "frame");
+
+			for (int i = 0; i < nativeFunctionCount; i++) {
+				fprintf(callStatsFile, ",%s_calls,%s_ms", nativeFunctions[i].name, nativeFunctions[i].name);
+			}
+
+			fprintf(callStatsFile, "\n");
+			callStatsColumnCount = nativeFunctionCount;
+		}
+	}
+
+	if (callStatsFile != NULL) {
+		fprintf(callStatsFile, "%d", callStatsFrameCount);
+
+		for (int i = 0; i < callStatsColumnCount; i++) {
+			fprintf(callStatsFile, ",%d,%.4f", nativeFunctions[i].frameCallCount, ticksToMs(nativeFunctions[i].frameTicks));
+		}
+
+		fprintf(callStatsFile, "\n");
+	}
+
+	for (int i = 0; i < nativeFunctionCount; i++) {
+		NativeFunction* nativeFunction = &nativeFunctions[i];
+		nativeFunction->ticks += nativeFunction->frameTicks;
+
+		if (nativeFunction->frameCallCount > nativeFunction->maxFrameCallCount) {
+			nativeFunction->maxFrameCallCount = nativeFunction->frameCallCount;
+		}
+
+		nativeFunction->frameCallCount = 0;
+		nativeFunction->frameTicks = 0;
+	}
+
+	callStatsFrameCount++;
+}
+
+int compareNativeFunctionTime(const void* a, const void* b) {
+	Uint64 ticksA = nativeFunctions[*(const int*) a].ticks;
+	Uint64 ticksB = nativeFunctions[*(const int*) b].ticks;
+
+	return (ticksA < ticksB) - (ticksA > ticksB);
+}
+
+int compareNativeCallerTime(const void* a, const void* b) {
+	Uint64 ticksA = ((const NativeCaller*) a)->ticks;
+	Uint64 ticksB = ((const NativeCaller*) b)->ticks;
+
+	return (ticksA < ticksB) - (ticksA > ticksB);
+}
+
+void printCallStats() {
+	if (!isCallStatsEnabled || callStatsFrameCount == 0) {
+		return;
+	}
+
+	int order[NATIVE_FUNCTION_MAX];
+
+	for (int i = 0; i < nativeFunctionCount; i++) {
+		order[i] = i;
+	}
+
+	qsort(order, nativeFunctionCount, sizeof(int), compareNativeFunctionTime);
+
+	printf("Native calls over %d frames (most time first):\n", callStatsFrameCount);
+	printf("  %-16s %12s %10s %10s %10s\n", "function", "calls/frame", "max/frame", "ms/frame", "total ms");
+
+	for (int i = 0; i < nativeFunctionCount; i++) {
+		NativeFunction* nativeFunction = &nativeFunctions[order[i]];
+
+		if (nativeFunction->callCount == 0) {
+			continue;
+		}
+
+		printf(
+			"  %-16s %12.1f %10d %10.4f %10.1f\n",
+			nativeFunction->name,
+			(double) nativeFunction->callCount / callStatsFrameCount,
+			nativeFunction->maxFrameCallCount,
+			ticksToMs(nativeFunction->ticks) / callStatsFrameCount,
+			ticksToMs(nativeFunction->ticks));
+	}
+
+	if (isCallerStatsEnabled) {
+		// sorting moves the empty slots to the end, so the table is done with after this
+		qsort(nativeCallers, NATIVE_CALLER_MAX, sizeof(NativeCaller), compareNativeCallerTime);
+
+		printf("Top javascript callers (most time first):\n");
+
+		for (int i = 0; i < NATIVE_CALLER_TOP && nativeCallers[i].callCount > 0; i++) {
+			NativeCaller* caller = &nativeCallers[i];
+
+			printf(
+				"  %s <- %s (line %d): %.1f calls/frame, %.4f ms/frame\n",
+				nativeFunctions[caller->functionIndex].name,
+				caller->name,
+				caller->lineNumber,
+				(double) caller->callCount / callStatsFrameCount,
+				ticksToMs(caller->ticks) / callStatsFrameCount);
+		}
+
+		if (nativeCallerDropCount > 0) {
+			printf("  (%" PRIu64 " calls came from callers that didn't fit in the table)\n", nativeCallerDropCount);
+		}
+	}
+}
+
+// adds native function `func` to the object at `objIdx` as `name`
+void putNativeFunction(duk_context* ctx, duk_idx_t objIdx, const char* name, duk_c_function func, duk_idx_t nargs) {
+	int index = 0;
+	while (index < nativeFunctionCount && nativeFunctions[index].func != func) {
+		index++;
+	}
+
+	int isTrampolined = isNativeCallCounting || isTracing || isCallStatsEnabled;
+
+	if (isTrampolined && index == nativeFunctionCount && nativeFunctionCount < NATIVE_FUNCTION_MAX) {
+		nativeFunctions[nativeFunctionCount++] = (NativeFunction) { .func = func, .name = name, };
+	}
+
+	if (isTrampolined && index < nativeFunctionCount) {
+		duk_push_c_function(ctx, nativeCallTrampoline, nargs);
+		duk_set_magic(ctx, -1, index);
+	}
+	else {
+		duk_push_c_function(ctx, func, nargs);
+	}
+
+	duk_put_prop_string(ctx, objIdx, name);
+}
+
+void initBitsyInterface(duk_context* ctx) {
+	// BITSY API v0.2
+
+	// create system object
+	duk_idx_t bitsySystemIdx = duk_push_object(ctx);
+
+	// CONSTANTS
+
+	// memory blocks
+	duk_push_int(ctx, BITSY_VIDEO);
+	duk_put_prop_string(ctx, bitsySystemIdx, "VIDEO");
+
+	duk_push_int(ctx, BITSY_TEXTBOX);
+	duk_put_prop_string(ctx, bitsySystemIdx, "TEXTBOX");
+
+	duk_push_int(ctx, BITSY_MAP1);
+	duk_put_prop_string(ctx, bitsySystemIdx, "MAP1");
+
+	duk_push_int(ctx, BITSY_MAP2);
+	duk_put_prop_string(ctx, bitsySystemIdx, "MAP2");
+
+	duk_push_int(ctx, BITSY_SOUND1);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND1");
+
+	duk_push_int(ctx, BITSY_SOUND2);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND2");
+
+	duk_push_int(ctx, BITSY_SOUND3);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND3");
+
+	duk_push_int(ctx, BITSY_SOUND4);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND4");
+
+	duk_push_int(ctx, BITSY_SOUND5);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND5");
+
+	duk_push_int(ctx, BITSY_SOUND6);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND6");
+
+	duk_push_int(ctx, BITSY_SOUND7);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND7");
+
+	duk_push_int(ctx, BITSY_SOUND8);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND8");
+
+	duk_push_int(ctx, BITSY_SOUND_ANY);
+	duk_put_prop_string(ctx, bitsySystemIdx, "SOUND_ANY");
+
+	// graphics modes
+	duk_push_int(ctx, BITSY_GFX_VIDEO);
+	duk_put_prop_string(ctx, bitsySystemIdx, "GFX_VIDEO");
+
+	duk_push_int(ctx, BITSY_GFX_MAP);
+	duk_put_prop_string(ctx, bitsySystemIdx, "GFX_MAP");
+
+	// text modes
+	duk_push_int(ctx, BITSY_TXT_HIREZ);
+	duk_put_prop_string(ctx, bitsySystemIdx, "TXT_HIREZ");
+
+	duk_push_int(ctx, BITSY_TXT_LOREZ);
+	duk_put_prop_string(ctx, bitsySystemIdx, "TXT_LOREZ");
+
+	// sizes
+	duk_push_int(ctx, BITSY_TILE_SIZE);
+	duk_put_prop_string(ctx, bitsySystemIdx, "TILE_SIZE");
+
+	duk_push_int(ctx, BITSY_MAP_SIZE);
+	duk_put_prop_string(ctx, bitsySystemIdx, "MAP_SIZE");
+
+	duk_push_int(ctx, BITSY_VIDEO_SIZE);
+	duk_put_prop_string(ctx, bitsySystemIdx, "VIDEO_SIZE");
+
+	// button codes
+	duk_push_int(ctx, BITSY_BTN_UP);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_UP");
+
+	duk_push_int(ctx, BITSY_BTN_DOWN);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_DOWN");
+
+	duk_push_int(ctx, BITSY_BTN_LEFT);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_LEFT");
+
+	duk_push_int(ctx, BITSY_BTN_RIGHT);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_RIGHT");
+
+	duk_push_int(ctx, BITSY_BTN_OK);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_OK");
+
+	duk_push_int(ctx, BITSY_BTN_MENU);
+	duk_put_prop_string(ctx, bitsySystemIdx, "BTN_MENU");
+
+	// pulse waves
+	duk_push_int(ctx, BITSY_PULSE_1_8);
+	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_8");
+
+	duk_push_int(ctx, BITSY_PULSE_1_4);
+	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_4");
+
+	duk_push_int(ctx, BITSY_PULSE_1_2);
+	duk_put_prop_string(ctx, bitsySystemIdx, "PULSE_1_2");
+
+	// log levels
+	duk_push_int(ctx, LOG_ERROR);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_ERROR");
+
+	duk_push_int(ctx, LOG_WARN);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_WARN");
+
+	duk_push_int(ctx, LOG_INFO);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_INFO");
+
+	duk_push_int(ctx, LOG_DEBUG);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_DEBUG");
+
+	duk_push_int(ctx, LOG_TRACE);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_TRACE");
+
+	duk_push_int(ctx, isBitsyLogQuiet ? -1 : logLevel);
+	duk_put_prop_string(ctx, bitsySystemIdx, "LOG_LEVEL");
+
+	// IO
+
+	putNativeFunction(ctx, bitsySystemIdx, "log", bitsyLog, 3);
+
+	putNativeFunction(ctx, bitsySystemIdx, "button", bitsyButton, 1);
+
+	putNativeFunction(ctx, bitsySystemIdx, "getGameData", bitsyGetGameData, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "getFontData", bitsyGetFontData, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "getWorldCache", bitsyGetWorldCache, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "putWorldCache", bitsyPutWorldCache, 1);
+
+	// GRAPHICS
+
+	putNativeFunction(ctx, bitsySystemIdx, "graphicsMode", bitsyGraphicsMode, DUK_VARARGS);
+
+	putNativeFunction(ctx, bitsySystemIdx, "textMode", bitsyTextMode, DUK_VARARGS);
+
+	putNativeFunction(ctx, bitsySystemIdx, "color", bitsyColor, 4);
+
+	putNativeFunction(ctx, bitsySystemIdx, "tile", bitsyTile, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "delete", bitsyDelete, 1);
+
+	putNativeFunction(ctx, bitsySystemIdx, "fill", bitsyFill, 2);
+
+	putNativeFunction(ctx, bitsySystemIdx, "set", bitsySet, 3);
+
+	putNativeFunction(ctx, bitsySystemIdx, "textbox", bitsyTextbox, DUK_VARARGS);
+
+	// SOUND
+
+	putNativeFunction(ctx, bitsySystemIdx, "sound", bitsySound, DUK_VARARGS);
+
+	putNativeFunction(ctx, bitsySystemIdx, "frequency", bitsyFrequency, 2);
+
+	putNativeFunction(ctx, bitsySystemIdx, "volume", bitsyVolume, 2);
+
+	putNativeFunction(ctx, bitsySystemIdx, "blip", bitsyBlip, 2);
+
+	putNativeFunction(ctx, bitsySystemIdx, "voice", bitsyVoice, 3);
+
+	putNativeFunction(ctx, bitsySystemIdx, "tune", bitsyTune, 6);
+
+	putNativeFunction(ctx, bitsySystemIdx, "tuneStop", bitsyTuneStop, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "tunePause", bitsyTunePause, 1);
+
+	putNativeFunction(ctx, bitsySystemIdx, "tuneBeat", bitsyTuneBeat, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "audioStats", bitsyAudioStats, 0);
+
+	putNativeFunction(ctx, bitsySystemIdx, "memoryStats", bitsyMemoryStats, 0);
+
+	// EVENTS
+
+	putNativeFunction(ctx, bitsySystemIdx, "loop", bitsyLoop, 1);
+
+	// BITSY SYSTEM
+
+	// assign name to system object
+	duk_put_global_string(ctx, "bitsy");
+
+	// RANDOM
+	duk_get_global_string(ctx, "Math");
+	putNativeFunction(ctx, -2, "random", mathRandom, 0);
+	duk_pop(ctx);
+}
+
+/* # INITIALIZATION */
+
+void initAudioSettings() {
+	audioVolume = 0.5f;
+	for (int i = 0; i < SOUND_CHANNEL_COUNT; i++) {
+		soundChannels[i].dutyCycle = pulseDutyCycle(BITSY_PULSE_1_2);
+		setChannelFrequency(&soundChannels[i], 440.0f); // A4 square wave
+	}
+	SDL_AtomicSet(&tunePosition, -1);
+}
+
+// puts the system state back how it is when bitsybox starts (other than the palette, which is cleared)
+void resetSystemState() {
+	initializeMemoryBlocks();
+
+	memset(curSystem, 0, sizeof(SystemState));
+	curSystem->graphicsMode = BITSY_GFX_VIDEO;
+	curSystem->textMode = BITSY_TXT_HIREZ;
+	curSystem->textboxRenderScale = 2;
+	curSystem->randomState = randomSeed;
+}
+
+void resetMemory() {
+	// initialize system memory
+	initializeMemoryBlocks();
+	curSystem->tileCount = 0;
+
+	// video mode memory
+	allocateMemoryBlock(BITSY_VIDEO, BITSY_VIDEO_SIZE * BITSY_VIDEO_SIZE);
+
+	// map mode memory
+	allocateMemoryBlock(BITSY_MAP1, BITSY_MAP_SIZE * BITSY_MAP_SIZE);
+	allocateMemoryBlock(BITSY_MAP2, BITSY_MAP_SIZE * BITSY_MAP_SIZE);
+
+	// textbox memory
+	allocateMemoryBlock(BITSY_TEXTBOX, curSystem->textboxWidth * curSystem->textboxHeight);
+
+	curSystem->shouldRenderTextures = 1;
+}
+
+void resetMemoryAndTextures() {
+	// delete any textures (the renderer creates new ones for the new program's memory)
+	for (int i = 0; i < TEXTURE_MAX; i++) {
+		destroyTexture(i);
+	}
+
+	textboxTextureWidth = 0;
+	textboxTextureHeight = 0;
+
+	resetMemory();
+}
+
+// returns 1 if all of the engine loaded
+int loadEngine(duk_context* ctx) {
+	int success = 1;
+
+#ifdef BUILD_DEBUG
+	// load engine
+	success = success && loadScript(ctx, "bitsy/engine/world.js");
+	success = success && loadScript(ctx, "bitsy/engine/sound.js");
+	success = success && loadScript(ctx, "bitsy/engine/font.js");
+	success = success && loadScript(ctx, "bitsy/engine/transition.js");
+	success = success && loadScript(ctx, "bitsy/engine/script.js");
+	success = success && loadScript(ctx, "bitsy/engine/dialog.js");
+	success = success && loadScript(ctx, "bitsy/engine/renderer.js");
+	success = success && loadScript(ctx, "bitsy/engine/bitsy.js");
+	// load default font
+	success = success && loadFile(ctx, "bitsy/font/ascii_small.bitsyfont", "__bitsybox_default_font__");
+#else
+	// load engine
+	success = success && loadEmbeddedScript(ctx, world_js);
+	success = success && loadEmbeddedScript(ctx, sound_js);
+	success = success && loadEmbeddedScript(ctx, font_js);
+	success = success && loadEmbeddedScript(ctx, transition_js);
+	success = success && loadEmbeddedScript(ctx, script_js);
+	success = success && loadEmbeddedScript(ctx, dialog_js);
+	success = success && loadEmbeddedScript(ctx, renderer_js);
+	success = success && loadEmbeddedScript(ctx, bitsy_js);
+	// load default font (prebaked by the embed script so it doesn't need to be parsed)
+	success = success && loadEmbeddedBuffer(ctx, ascii_small_bitsyfont_glyphs, ascii_small_bitsyfont_glyphs_size, "__bitsybox_default_font__");
+#endif
+
+	return success;
+}
+
+void initSystem(duk_context* ctx) {
+	// don't let a tune from the previous program keep playing
+	AudioCommand stopTuneCommand = {
+		.type = AUDIO_TUNE_STOP,
+		.time = audioCommandTime(0),
+	};
+	pushAudioCommand(&stopTuneCommand);
+
+	resetMemoryAndTextures();
+	initBitsyInterface(ctx);
+	shouldContinue = shouldContinue && loadEngine(ctx);
+}
+
+/* # FRAME TIMING */
+
+// the engine is always updated in fixed steps of 1/60th of a second, however often frames are
+// actually shown, so animation and movement timing don't depend on how fast the machine is
+#define FRAME_RATE 60
+#define FRAME_STEP_MS (1000.0 / FRAME_RATE)
+// if the game falls further behind than this many updates, the extra time is skipped
+// instead of being caught up (which would only make it fall further behind)
+#define FRAME_CATCH_UP_MAX 4
+
+// wait for the display's refresh before showing each frame (turned on with `--vsync`)
+int isVsyncEnabled = 0;
+
+typedef struct FrameScheduler {
+	Uint64 stepTime; // length of one update in performance counter ticks
+	Uint64 prevTime;
+	Uint64 pendingTime; // time that hasn't been simulated yet
+	int skippedUpdateCount;
+} FrameScheduler;
+
+void startFrameScheduler(FrameScheduler* scheduler) {
+	scheduler->stepTime = SDL_GetPerformanceFrequency() / FRAME_RATE;
+	scheduler->prevTime = SDL_GetPerformanceCounter();
+	scheduler->pendingTime = 0;
+	scheduler->skippedUpdateCount = 0;
+}
+
+// sleeps until at least one update is due, then returns how many updates to run this frame
+int waitForFrameUpdates(FrameScheduler* scheduler) {
+	while (1) {
+		Uint64 time = SDL_GetPerformanceCounter();
+		scheduler->pendingTime += time - scheduler->prevTime;
+		scheduler->prevTime = time;
+
+		if (scheduler->pendingTime >= scheduler->stepTime) {
+			break;
+		}
+
+		Uint64 remainingTime = scheduler->stepTime - scheduler->pendingTime;
+		Uint32 remainingMs = (Uint32) (remainingTime * 1000 / SDL_GetPerformanceFrequency());
+
+		if (!isVsyncEnabled) {
+			SDL_Delay(remainingMs > 0 ? remainingMs : 1);
+		}
+		else {
+			// presenting usually waited for the display already, but not on displays faster than 60 Hz
+			// (or drivers that ignore vsync): sleep too, waking a little early so the refresh isn't missed
+			SDL_Delay(remainingMs > 1 ? remainingMs - 1 : 0);
+		}
+	}
+
+	int updateCount = (int) (scheduler->pendingTime / scheduler->stepTime);
+
+	if (updateCount > FRAME_CATCH_UP_MAX) {
+		scheduler->skippedUpdateCount += updateCount - FRAME_CATCH_UP_MAX;
+		updateCount = FRAME_CATCH_UP_MAX;
+		scheduler->pendingTime = updateCount * scheduler->stepTime;
+	}
+
+	scheduler->pendingTime -= updateCount * scheduler->stepTime;
+
+	return updateCount;
+}
+
+/* # FRAME PROFILER */
+
+// the time each frame spends in every phase of `updateSystem` is kept for the last few seconds:
+// F3 draws it as a graph over the screen, and F4 writes it to a CSV file (see `--profile-file`)
+#define PROFILE_FRAME_MAX 240
+
+#define PROFILE_WAIT 0 // sleeping until the next update is due
+#define PROFILE_EVENTS 1 // event pump, input recording and stats
+#define PROFILE_UPDATE 2 // running the engine (with `--update-thread`, just the time spent waiting for it)
+#define PROFILE_RASTERIZE 3 // drawing memory blocks into textures
+#define PROFILE_COMPOSE 4 // copying the textures to the window
+#define PROFILE_PRESENT 5
+#define PROFILE_PHASE_COUNT 6
+
+const char* profilePhaseNames[PROFILE_PHASE_COUNT] = { "wait", "events", "update", "rasterize", "compose", "present" };
+
+Color profilePhaseColors[PROFILE_PHASE_COUNT] = {
+	{ 0x40, 0x40, 0x40 },
+	{ 0xff, 0xd0, 0x00 },
+	{ 0xff, 0x30, 0x30 },
+	{ 0x30, 0xd0, 0x30 },
+	{ 0x30, 0x80, 0xff },
+	{ 0xc0, 0x40, 0xff },
+};
+
+typedef struct ProfileFrame {
+	double phaseMs[PROFILE_PHASE_COUNT];
+	double updateThreadMs; // the whole engine update when it ran on the update thread
+	int updateCount;
+} ProfileFrame;
+
+ProfileFrame profileFrames[PROFILE_FRAME_MAX];
+int profileFrameCount = 0; // frames profiled so far (the current one is the newest)
+ProfileFrame* curProfileFrame = &profileFrames[0];
+Uint64 profilePhaseStart = 0;
+int isProfileOverlayVisible = 0;
+char profileFilePath[256] = "profile.csv";
+
+void startProfileFrame() {
+	curProfileFrame = &profileFrames[profileFrameCount % PROFILE_FRAME_MAX];
+	*curProfileFrame = (ProfileFrame) { 0 };
+	profileFrameCount++;
+	profilePhaseStart = SDL_GetPerformanceCounter();
+}
+
+// adds the time since the previous phase ended to `phase`
+void endProfilePhase(int phase) {
+	Uint64 time = SDL_GetPerformanceCounter();
+	curProfileFrame->phaseMs[phase] += ticksToMs(time - profilePhaseStart);
+	traceSpan("frame", profilePhaseNames[phase], profilePhaseStart, time);
+	profilePhaseStart = time;
+}
+
+double profileFrameMs(ProfileFrame* frame) {
+	double totalMs = 0;
+
+	for (int i = 0; i < PROFILE_PHASE_COUNT; i++) {
+		totalMs += frame->phaseMs[i];
+	}
+
+	return totalMs;
+}
+
+// the oldest finished frame still in the ring buffer (the slot before it is the current frame's)
+int firstProfileFrame(int lastFrame) {
+	return lastFrame > (PROFILE_FRAME_MAX - 1) ? lastFrame - (PROFILE_FRAME_MAX - 1) : 0;
+}
+
+void writeProfileCsv() {
+	FILE* file = fopen(profileFilePath, "w");
+
+	if (file == NULL) {
+		printf("Couldn't write the profile to %s\n", profileFilePath);
+		return;
+	}
+
+	fprintf(file, "frame,updates");
+	for (int i = 0; i < PROFILE_PHASE_COUNT; i++) {
+		fprintf(file, ",%s_ms", profilePhaseNames[i]);
+	}
+	fprintf(file, ",update_thread_ms,total_ms\n");
+
+	// every finished frame still in the ring buffer, oldest first
+	int lastFrame = profileFrameCount - 1;
+	int firstFrame = firstProfileFrame(lastFrame);
+
+	for (int i = firstFrame; i < lastFrame; i++) {
+		ProfileFrame* frame = &profileFrames[i % PROFILE_FRAME_MAX];
+
+		fprintf(file, "%d,%d", i, frame->updateCount);
+		for (int j = 0; j < PROFILE_PHASE_COUNT; j++) {
+			fprintf(file, ",%.3f", frame->phaseMs[j]);
+		}
+		fprintf(file, ",%.3f,%.3f\n", frame->updateThreadMs, profileFrameMs(frame));
+	}
+
+	fclose(file);
+	printf("Wrote %d frames to %s\n", lastFrame - firstFrame, profileFilePath);
+}
+
+void onProfileHotkey(SDL_Keycode key) {
+	if (key == SDLK_F3) {
+		isProfileOverlayVisible = !isProfileOverlayVisible;
+	}
+	else if (key == SDLK_F4 && !(isButtonLAlt || isButtonRAlt)) {
+		// (alt+F4 quits instead)
+		writeProfileCsv();
+	}
+}
+
+// a bar per frame along the bottom of the window, stacked by phase (the line marks one update step)
+void renderProfileOverlay() {
+	int barWidth = windowWidth / PROFILE_FRAME_MAX;
+	barWidth = barWidth > 0 ? barWidth : 1;
+	int graphHeight = windowHeight / 4;
+	float pixelsPerMs = graphHeight / (float) (FRAME_STEP_MS * 2);
+
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xa0);
+	SDL_Rect graphRect = { 0, windowHeight - graphHeight, windowWidth, graphHeight };
+	SDL_RenderFillRect(renderer, &graphRect);
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+	int lastFrame = profileFrameCount - 1;
+	int firstFrame = firstProfileFrame(lastFrame);
+
+	for (int i = firstFrame; i < lastFrame; i++) {
+		ProfileFrame* frame = &profileFrames[i % PROFILE_FRAME_MAX];
+		int barX = (i - firstFrame) * barWidth;
+		int barBottom = windowHeight;
+
+		for (int j = 0; j < PROFILE_PHASE_COUNT; j++) {
+			int barHeight = (int) (frame->phaseMs[j] * pixelsPerMs + 0.5f);
+
+			if (barHeight > 0) {
+				Color color = profilePhaseColors[j];
+				SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, 0x00);
+				SDL_Rect barRect = { barX, barBottom - barHeight, barWidth, barHeight };
+				SDL_RenderFillRect(renderer, &barRect);
+				barBottom -= barHeight;
+			}
+		}
+	}
+
+	int stepY = windowHeight - (int) (FRAME_STEP_MS * pixelsPerMs);
+	SDL_SetRenderDrawColor(renderer, 0xff, 0xff, 0xff, 0x00);
+	SDL_RenderDrawLine(renderer, 0, stepY, windowWidth, stepY);
+}
+
+/* # UPDATE */
+
+void setButtonBinding(ButtonBinding* bindings, int bindingCount, int code, int isDown) {
+	for (int i = 0; i < bindingCount; i++) {
+		if (bindings[i].code != code) {
+			continue;
+		}
+
+		if (isDown) {
+			if (!*bindings[i].state) {
+				traceInputDelivered();
+			}
+
+			*bindings[i].state = 1;
+			bindings[i].wasPressedThisFrame = 1;
+			bindings[i].isReleasePending = 0;
+		}
+		else if (bindings[i].wasPressedThisFrame) {
+			// keep quick taps down for one frame so the game still sees them
+			bindings[i].isReleasePending = 1;
+		}
+		else {
+			*bindings[i].state = 0;
+		}
+
+		return;
+	}
+}
+
+// applies releases that were held back from the previous frame
+void startButtonFrame(ButtonBinding* bindings, int bindingCount) {
+	for (int i = 0; i < bindingCount; i++) {
+		if (bindings[i].isReleasePending) {
+			*bindings[i].state = 0;
+			bindings[i].isReleasePending = 0;
+		}
+
+		bindings[i].wasPressedThisFrame = 0;
+	}
+}
+
+void updateInput() {
+	startButtonFrame(keyBindings, KEY_BINDING_COUNT);
+	startButtonFrame(padBindings, PAD_BINDING_COUNT);
+
+	// handle every event that arrived since the last frame
+	while (SDL_PollEvent(&event)) {
+		switch (event.type) {
+			case SDL_QUIT:
+				shouldContinue = 0;
+				break;
+			case SDL_WINDOWEVENT:
+				if (event.window.event == SDL_WINDOWEVENT_RESIZED) {
+					didWindowResizeThisFrame = 1;
+				}
+				break;
+			case SDL_KEYDOWN:
+			case SDL_KEYUP:
+				setButtonBinding(keyBindings, KEY_BINDING_COUNT, event.key.keysym.sym, event.type == SDL_KEYDOWN);
+
+				if (event.type == SDL_KEYDOWN && !event.key.repeat) {
+					onProfileHotkey(event.key.keysym.sym);
+				}
+				break;
+			case SDL_CONTROLLERDEVICEADDED:
+				SDL_GameControllerOpen(event.cdevice.which);
+				break;
+			case SDL_CONTROLLERBUTTONDOWN:
+			case SDL_CONTROLLERBUTTONUP:
+				setButtonBinding(padBindings, PAD_BINDING_COUNT, event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN);
+				break;
+		}
+	}
+
+	// get mouse state
+	int windowMouseX = 0;
+	int windowMouseY = 0;
+	isLeftMouseDown = SDL_GetMouseState(&windowMouseX, &windowMouseY) & SDL_BUTTON(1);
+
+	// normalize mouse position to bitsy scale
+	int screenSize = (windowWidth <= windowHeight) ? windowWidth : windowHeight;
+	int screenLeft = (windowWidth / 2) - (screenSize / 2);
+	int screenTop = (windowHeight / 2) - (screenSize / 2);
+	float pixelRatio = ((float) BITSY_VIDEO_SIZE) / ((float) screenSize);
+	mouseX = floor((windowMouseX - screenLeft) * pixelRatio);
+	mouseY = floor((windowMouseY - screenTop) * pixelRatio);
+
+	// toggle fullscreen
+	int prevFrameFullscreenShortcut = isFullscreenShortcut;
+	isFullscreenShortcut = (isButtonLAlt || isButtonRAlt) && isButtonReturn;
+
+	if (isFullscreenShortcut && !prevFrameFullscreenShortcut) {
+		isFullscreen = (isFullscreen == 0 ? 1 : 0);
+
+		SDL_ShowCursor(!isFullscreen);
+		SDL_SetWindowFullscreen(window, isFullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0);
+
+		if (!isFullscreen) {
+			SDL_SetWindowSize(window, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale));
+		}
+
+		didWindowResizeThisFrame = 1;
+	}
+}
+
+// textures are created and destroyed here (on the main thread) to match the frame's memory blocks,
+// returns 1 if any new textures need to be drawn
+int updateTextures(FrameSnapshot* frame) {
+	int didCreateTextures = 0;
+
+	if (textures[BITSY_VIDEO] == NULL) {
+		textures[BITSY_VIDEO] = createTexture(SDL_PIXELFORMAT_RGB888, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale));
+		didCreateTextures = 1;
+	}
+
+	// map mode textures
+	if (textures[BITSY_MAP1] == NULL) {
+		textures[BITSY_MAP1] = createTexture(SDL_PIXELFORMAT_RGB888, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale));
+		didCreateTextures = 1;
+	}
+
+	if (textures[BITSY_MAP2] == NULL) {
+		textures[BITSY_MAP2] = createTexture(SDL_PIXELFORMAT_RGBA8888, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale));
+		// enable alpha blending for the foreground tile map texture
+		SDL_SetTextureBlendMode(textures[BITSY_MAP2], SDL_BLENDMODE_BLEND);
+		didCreateTextures = 1;
+	}
+
+	// the textbox texture is replaced whenever its size (or text mode) changes
+	int textureWidth = frame->textboxWidth * frame->textboxRenderScale;
+	int textureHeight = frame->textboxHeight * frame->textboxRenderScale;
+
+	int isTextboxEmpty = textureWidth <= 0 || textureHeight <= 0;
+
+	if ((textures[BITSY_TEXTBOX] == NULL && !isTextboxEmpty) || textureWidth != textboxTextureWidth || textureHeight != textboxTextureHeight) {
+		destroyTexture(BITSY_TEXTBOX);
+
+		if (!isTextboxEmpty) {
+			textures[BITSY_TEXTBOX] = createTexture(SDL_PIXELFORMAT_RGB888, textureWidth, textureHeight);
+			didCreateTextures = 1;
+		}
+
+		textboxTextureWidth = textureWidth;
+		textboxTextureHeight = textureHeight;
+	}
+
+	// tiles
+	for (int i = BITSY_TILE_START; i < TEXTURE_MAX; i++) {
+		if (isFrameBlockEmpty(frame, i)) {
+			destroyTexture(i);
+		}
+		else if (textures[i] == NULL) {
+			textures[i] = createTexture(SDL_PIXELFORMAT_RGB888, (BITSY_TILE_SIZE * renderScale), (BITSY_TILE_SIZE * renderScale));
+			didCreateTextures = 1;
+		}
+	}
+
+	return didCreateTextures;
+}
+
+void renderVideoTexture(FrameSnapshot* frame) {
+	int backgroundColorIndex = 16;
+	Color bgColor = frame->palette[backgroundColorIndex];
+
+	// will changing these a bunch cause a perf issue?
+	SDL_SetRenderTarget(renderer, textures[BITSY_VIDEO]);
+
+	// fill background
+	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
+	SDL_Rect videoFillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
+	SDL_RenderFillRect(renderer, &videoFillRect);
+
+	// draw pixels
+	if (!isFrameBlockEmpty(frame, BITSY_VIDEO)) {
+		MemoryBlock videoMemory = frame->memory[BITSY_VIDEO];
+		for (int i = 0; i < videoMemory.size; i++) {
+			int pixelColorIndex = videoMemory.data[i];
+
+			// skip background color since that's the fill color
+			if (pixelColorIndex >= 0 && pixelColorIndex != backgroundColorIndex) {
+				int pixelX = i % BITSY_VIDEO_SIZE;
+				int pixelY = i / BITSY_VIDEO_SIZE;
+
+				Color pixelColor = frame->palette[pixelColorIndex];
+				SDL_Rect pixelRect = { (pixelX * renderScale), (pixelY * renderScale), renderScale, renderScale, };
+				SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0x00);
+				SDL_RenderFillRect(renderer, &pixelRect);
+			}
+		}		
+	}
+}
+
+void renderTileTextures(FrameSnapshot* frame) {
+	int backgroundColorIndex = 16;
+	Color bgColor = frame->palette[backgroundColorIndex];
+
+	// render tiles
+	for (int tileIndex = BITSY_TILE_START; tileIndex < MEMORY_BLOCK_MAX; tileIndex++) {
+		if (textures[tileIndex] != NULL) {
+			SDL_SetRenderTarget(renderer, textures[tileIndex]);
+
+			SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0xFF);
+			SDL_Rect tileFillRect = { 0, 0, (BITSY_TILE_SIZE * renderScale), (BITSY_TILE_SIZE * renderScale), };
+			SDL_RenderFillRect(renderer, &tileFillRect);
+
+			if (!isFrameBlockEmpty(frame, tileIndex)) {
+				MemoryBlock tileMemory = frame->memory[tileIndex];
+				for (int pixelIndex = 0; pixelIndex < tileMemory.size; pixelIndex++) {
+					int pixelColorIndex = tileMemory.data[pixelIndex];
+
+					// skip background color since that's the fill color
+					if (pixelColorIndex >= 0 && pixelColorIndex != backgroundColorIndex) {
+						Color pixelColor = frame->palette[pixelColorIndex];
+
+						// convert index to 2d coords
+						int pixelX = pixelIndex % BITSY_TILE_SIZE;
+						int pixelY = pixelIndex / BITSY_TILE_SIZE;
+
+						SDL_Rect pixelRect = { (pixelX * renderScale), (pixelY * renderScale), renderScale, renderScale, };
+						SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0xFF);
+						SDL_RenderFillRect(renderer, &pixelRect);
+					}
+				}
+			}
+		}
+	}
+
+	// render tilemap 1
+	SDL_SetRenderTarget(renderer, textures[BITSY_MAP1]);
+
+	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
+	SDL_Rect map1FillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
+	SDL_RenderFillRect(renderer, &map1FillRect);
+
+	if (!isFrameBlockEmpty(frame, BITSY_MAP1)) {
+		MemoryBlock map1Memory = frame->memory[BITSY_MAP1];
+		for (int i = 0; i < map1Memory.size; i++) {
+			int tileId = map1Memory.data[i];
+
+			// convert index to 2d *tile* coords
+			int tileX = i % BITSY_MAP_SIZE;
+			int tileY = i / BITSY_MAP_SIZE;
+
+			SDL_Rect tileRect = {
+				(tileX * BITSY_TILE_SIZE * renderScale),
+				(tileY * BITSY_TILE_SIZE * renderScale),
+				(BITSY_TILE_SIZE * renderScale),
+				(BITSY_TILE_SIZE * renderScale),
+			};
+
+			if (tileId >= BITSY_TILE_START && tileId < TEXTURE_MAX && textures[tileId] != NULL) {
+				SDL_RenderCopy(renderer, textures[tileId], NULL, &tileRect);
+			}
+		}
+	}
+
+	// render tilemap 2
+	SDL_SetRenderTarget(renderer, textures[BITSY_MAP2]);
+
+	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
+	SDL_Rect map2FillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
+	SDL_RenderFillRect(renderer, &map2FillRect);
+
+	if (!isFrameBlockEmpty(frame, BITSY_MAP2)) {
+		MemoryBlock map2Memory = frame->memory[BITSY_MAP2];
+		for (int i = 0; i < map2Memory.size; i++) {
+			int tileId = map2Memory.data[i];
+
+			// convert index to 2d *tile* coords
+			int tileX = i % BITSY_MAP_SIZE;
+			int tileY = i / BITSY_MAP_SIZE;
+
+			SDL_Rect tileRect = {
+				(tileX * BITSY_TILE_SIZE * renderScale),
+				(tileY * BITSY_TILE_SIZE * renderScale),
+				(BITSY_TILE_SIZE * renderScale),
+				(BITSY_TILE_SIZE * renderScale),
+			};
+
+			if (tileId >= BITSY_TILE_START && tileId < TEXTURE_MAX && textures[tileId] != NULL) {
+				SDL_RenderCopy(renderer, textures[tileId], NULL, &tileRect);
+			}
+		}
+	}
+
+	// render textbox
+	SDL_SetRenderTarget(renderer, textures[BITSY_TEXTBOX]);
+
+	Color textboxBgColor = frame->palette[0];
+	SDL_SetRenderDrawColor(renderer, textboxBgColor.r, textboxBgColor.g, textboxBgColor.b, 0x00);
+	SDL_Rect textboxFillRect = { 0, 0, (frame->textboxWidth * frame->textboxRenderScale), (frame->textboxHeight * frame->textboxRenderScale), };
+	SDL_RenderFillRect(renderer, &textboxFillRect);
+
+	if (!isFrameBlockEmpty(frame, BITSY_TEXTBOX)) {
+		MemoryBlock textboxMemory = frame->memory[BITSY_TEXTBOX];
+		for (int i = 0; i < textboxMemory.size; i++) {
+			int pixelColorIndex = textboxMemory.data[i];
+
+			// since the texture is filled with color 0, we can skip pixels with that color
+			if (pixelColorIndex > 0) {
+				Color pixelColor = frame->palette[pixelColorIndex];
+
+				// convert index to 2d coords
+				int pixelX = i % frame->textboxWidth;
+				int pixelY = i / frame->textboxWidth;
+
+				SDL_Rect pixelRect = { (pixelX * frame->textboxRenderScale), (pixelY * frame->textboxRenderScale), frame->textboxRenderScale, frame->textboxRenderScale, };
+				SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0x00);
+				SDL_RenderFillRect(renderer, &pixelRect);
+			}
+		}
+	}
+}
+
+void renderFrame(FrameSnapshot* frame) {
+	int backgroundColorIndex = 16;
+	Color bgColor = frame->palette[backgroundColorIndex];
+
+	int screenSize = (windowWidth <= windowHeight) ? windowWidth : windowHeight;
+
+	SDL_Rect screenRect = (SDL_Rect) {
+		(windowWidth / 2) - (screenSize / 2),
+		(windowHeight / 2) - (screenSize / 2),
+		screenSize,
+		screenSize,
+	};
+
+	// update textures
+	int didCreateTextures = updateTextures(frame);
+
+	if (frame->shouldRenderTextures || didCreateTextures) {
+		if (frame->graphicsMode == BITSY_GFX_VIDEO) {
+			renderVideoTexture(frame);
+		}
+		else {
+			renderTileTextures(frame);
+		}
+	}
+
+	endProfilePhase(PROFILE_RASTERIZE);
+
+	// render screen
+	SDL_SetRenderTarget(renderer, NULL);
+
+	// fill the screen with the background color
+	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
+	SDL_Rect windowRect = { 0, 0, windowWidth, windowHeight };
+	SDL_RenderFillRect(renderer, &windowRect);
+
+	if (frame->graphicsMode == BITSY_GFX_VIDEO) {
+		// copy the screen buffer texture into the renderer
+		SDL_RenderCopy(renderer, textures[BITSY_VIDEO], NULL, &screenRect);
+	}
+	else {
+		// draw tile map layers
+		SDL_RenderCopy(renderer, textures[BITSY_MAP1], NULL, &screenRect);
+		SDL_RenderCopy(renderer, textures[BITSY_MAP2], NULL, &screenRect);
+
+		// draw textbox
+		if (frame->isTextboxVisible) {
+			// calculate textbox dimensions in terms of the current window size
+			float bitsyToScreenRatio = ((float) screenSize) / ((float) BITSY_VIDEO_SIZE);
+			float textboxRatio = ((float) frame->textboxRenderScale) / ((float) renderScale);
+			SDL_Rect textboxRect = {
+				screenRect.x + (frame->textboxX * bitsyToScreenRatio),
+				screenRect.y + (frame->textboxY * bitsyToScreenRatio),
+				(frame->textboxWidth * textboxRatio * bitsyToScreenRatio),
+				(frame->textboxHeight * textboxRatio * bitsyToScreenRatio),
+			};
+
+			SDL_RenderCopy(renderer, textures[BITSY_TEXTBOX], NULL, &textboxRect);
+		}
+	}
+
+	if (isProfileOverlayVisible) {
+		renderProfileOverlay();
+	}
+
+	endProfilePhase(PROFILE_COMPOSE);
+
+	// show the frame
+	SDL_RenderPresent(renderer);
+	traceInputPresent(frame->captureTime);
+
+	endProfilePhase(PROFILE_PRESENT);
+}
+
+// execute engine main loop (more than once if it needs to catch up)
+void runEngineUpdates(duk_context* ctx, int updateCount) {
+	for (int i = 0; i < updateCount; i++) {
+		Uint64 startTime = SDL_GetPerformanceCounter();
+
+		if (duk_peval_string(ctx, "__bitsybox_on_update__(__bitsybox_delta_time__);") != 0) {
+			printf("Update Bitsy Error: %s\n", duk_safe_to_string(ctx, -1));
+		}
+		duk_pop(ctx);
+
+		traceSpan("js", "engine update", startTime, SDL_GetPerformanceCounter());
+	}
+}
+
+/* ## UPDATE THREAD */
+
+// with `--update-thread` the engine runs on its own thread: each frame the main thread hands it
+// the input, draws the snapshot from the previous update meanwhile, then waits for it to finish
+// (so the VM is only ever used by one thread at a time, and SDL rendering stays on this one)
+int isUpdateThreadEnabled = 0;
+SDL_Thread* updateThread = NULL;
+SDL_sem* updateJobReady = NULL;
+SDL_sem* updateJobDone = NULL;
+duk_context* updateJobContext = NULL;
+int updateJobCount = 0;
+double updateJobMs = 0;
+int isUpdateThreadStopping = 0;
+
+// double buffered: the update thread fills one while the main thread draws the other
+FrameSnapshot frameSnapshots[2];
+int frontFrameIndex = 0;
+
+int updateThreadMain(void* data) {
+	traceThreadName("update");
+
+	while (1) {
+		SDL_SemWait(updateJobReady);
+
+		if (isUpdateThreadStopping) {
+			break;
+		}
+
+		Uint64 startTime = SDL_GetPerformanceCounter();
+		runEngineUpdates(updateJobContext, updateJobCount);
+		captureFrame(&frameSnapshots[1 - frontFrameIndex], 1);
+		updateJobMs = ticksToMs(SDL_GetPerformanceCounter() - startTime);
+
+		SDL_SemPost(updateJobDone);
+	}
+
+	return 0;
+}
+
+void startUpdateThread() {
+	updateJobReady = SDL_CreateSemaphore(0);
+	updateJobDone = SDL_CreateSemaphore(0);
+	updateThread = SDL_CreateThread(updateThreadMain, "bitsybox update", NULL);
+
+	if (updateThread == NULL) {
+		printf("Couldn't start the update thread: %s\n", SDL_GetError());
+		isUpdateThreadEnabled = 0;
+	}
+}
+
+void stopUpdateThread() {
+	if (updateThread != NULL) {
+		isUpdateThreadStopping = 1;
+		SDL_SemPost(updateJobReady);
+		SDL_WaitThread(updateThread, NULL);
+		updateThread = NULL;
+	}
+
+	if (updateJobReady != NULL) {
+		SDL_DestroySemaphore(updateJobReady);
+		SDL_DestroySemaphore(updateJobDone);
+		updateJobReady = NULL;
+		updateJobDone = NULL;
+	}
+}
+
+/* ## FRAME */
+
+void updateSystem(duk_context* ctx, FrameScheduler* scheduler) {
+	Uint64 frameStartTime = SDL_GetPerformanceCounter();
+	startProfileFrame();
+
+	int updateCount = waitForFrameUpdates(scheduler);
+
+	endProfilePhase(PROFILE_WAIT);
+
+	// get latest input
+	updateInput();
+
+	if (inputReplayFile != NULL) {
+		if (!replayInputFrame(&updateCount)) {
+			// the session is over
+			shouldContinue = 0;
+			updateCount = 0;
+		}
+	}
+	else if (inputRecordFile != NULL) {
+		recordInputFrame(updateCount);
+	}
+
+	updateAudioStatsDump();
+	updateMemoryStatsDump(ctx);
+
+	// every update gets the same fixed delta time
+	duk_push_number(ctx, FRAME_STEP_MS);
+	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+
+	curProfileFrame->updateCount = updateCount;
+	endProfilePhase(PROFILE_EVENTS);
+
+	if (isUpdateThreadEnabled) {
+		// run the engine on the update thread while this one draws the previous update's frame
+		updateJobContext = ctx;
+		updateJobCount = updateCount;
+		SDL_SemPost(updateJobReady);
+
+		renderFrame(&frameSnapshots[frontFrameIndex]);
+
+		// wait for the engine so the caller can use the VM, then show its frame next time
+		SDL_SemWait(updateJobDone);
+		frontFrameIndex = 1 - frontFrameIndex;
+
+		endProfilePhase(PROFILE_UPDATE);
+		curProfileFrame->updateThreadMs = updateJobMs;
+	}
+	else {
+		runEngineUpdates(ctx, updateCount);
+		captureFrame(&frameSnapshots[frontFrameIndex], 0);
+
+		endProfilePhase(PROFILE_UPDATE);
+
+		// draw frame
+		renderFrame(&frameSnapshots[frontFrameIndex]);
+	}
+
+	if (didWindowResizeThisFrame) {
+		onWindowResize();
+	}
+
+	didWindowResizeThisFrame = 0;
+
+	endProfilePhase(PROFILE_EVENTS);
+
+	// duktape has no hook for its garbage collector, but collections show up as drops in the heap size
+	traceSpan("frame", "frame", frameStartTime, SDL_GetPerformanceCounter());
+	traceCounter("javascript heap bytes", getHeapStats(ctx)->bytes);
+	flushTrace();
+
+	endCallStatsFrame();
+	updateLog();
+}
+
+/* # BITSYBOX MODES */
+
+int shouldStartTuneDemo = 0;
+
+void bootMenu() {
+	SDL_SetWindowTitle(window, "BITSYBOX");
+	recordInputProgram(INPUT_PROGRAM_BOOT);
+
+	duk_context* ctx = createCountingHeap();
+
+	// load game files
+	duk_peval_string(ctx, "__bitsybox_game_files__ = []");
+	duk_pop(ctx);
+	struct dirent* files;
+	DIR* dir = opendir("./games");
+
+	if (dir != NULL ) {
+		while ((files = readdir(dir)) != NULL) {
+			duk_push_string(ctx, files->d_name);
+			duk_put_global_string(ctx, "__bitsybox_filename__");
+			duk_peval_string(
+				ctx,
+				"var fileSplit = __bitsybox_filename__.split('.');"
+				"if (fileSplit[fileSplit.length - 1] === 'bitsy') { __bitsybox_game_files__.push(__bitsybox_filename__); }");
+			duk_pop(ctx);
+		}
+
+		closedir(dir);
+	}
+
+	int isBootFinished = 0;
+
+	initSystem(ctx);
+
+	// load boot menu
+#ifdef BUILD_DEBUG
+	shouldContinue = shouldContinue && loadScript(ctx, "boot/boot.js");
+	shouldContinue = shouldContinue && loadFile(ctx, "boot/boot.bitsy", "__bitsybox_game_data__");
+#else
+	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, boot_js);
+	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, boot_bitsy, "__bitsybox_game_data__");
+#endif
+
+	FrameScheduler frameScheduler;
+	startFrameScheduler(&frameScheduler);
+
+	while (shouldContinue && !isBootFinished) {
+		updateSystem(ctx, &frameScheduler);
+
+		duk_peval_string(ctx, "__bitsybox_is_boot_finished__");
+		isBootFinished = duk_get_boolean(ctx, -1);
+		duk_pop(ctx);
+	}
+
+	if (isBootFinished) {
+		duk_peval_string(ctx, "__bitsybox_selected_game_name__");
+		SDL_SetWindowTitle(window, duk_get_string(ctx, -1));
+		duk_pop(ctx);
+
+		duk_peval_string(ctx, "__bitsybox_selected_game__");
+		sprintf(gameFilePath, "./games/%s", duk_get_string(ctx, -1));
+		duk_pop(ctx);
+
+		duk_peval_string(ctx, "__bitsybox_game_files__.length");
+		gameCount = duk_get_int(ctx, -1);
+		duk_pop(ctx);
+
+		duk_peval_string(ctx, "__bitsybox_should_start_tune_demo__");
+		shouldStartTuneDemo = duk_get_boolean(ctx, -1);
+		duk_pop(ctx);
+	}
+
+	destroyCountingHeap(ctx);
+}
+
+void gameLoop() {
+	recordInputProgram(INPUT_PROGRAM_GAME);
+
+	duk_context* ctx = createCountingHeap();
+
+	int isGameOver = 0;
+
+	initSystem(ctx);
+
+	shouldContinue = shouldContinue && loadFile(ctx, gameFilePath, "__bitsybox_game_data__");
+
+	duk_peval_string(ctx, "var __bitsybox_is_game_over__ = false;");
+	duk_pop(ctx);
+
+	if (gameCount > 1) {
+		// hack to return to main menu on game end if there's more than one
+		duk_peval_string(ctx, "reset_cur_game = function() { __bitsybox_is_game_over__ = true; };");
+		duk_pop(ctx);
+	}
+
+	FrameScheduler frameScheduler;
+	startFrameScheduler(&frameScheduler);
+
+	while (shouldContinue && !isGameOver) {
+		updateSystem(ctx, &frameScheduler);
+
+		// kind of hacky way to trigger restart
+		if (duk_peval_string(ctx, "if (bitsy.button(bitsy.BTN_MENU)) { reset_cur_game(); }") != 0) {
+			printf("Test Restart Game Error: %s\n", duk_safe_to_string(ctx, -1));
+		}
+		duk_pop(ctx);
+
+		if (duk_peval_string(ctx, "__bitsybox_is_game_over__") != 0) {
+			printf("Test Game Over Error: %s\n", duk_safe_to_string(ctx, -1));
+		}
+		isGameOver = duk_get_boolean(ctx, -1);
+		duk_pop(ctx);
+	}
+
+	destroyCountingHeap(ctx);
+}
+
+void demoLoop() {
+	SDL_SetWindowTitle(window, "DEMO");
+	recordInputProgram(INPUT_PROGRAM_DEMO);
+
+	duk_context* ctx = createCountingHeap();
+
+	int isTestFinished = 0;
+
+	initSystem(ctx);
+
+	// load demo program
+#ifdef BUILD_DEBUG
+	shouldContinue = shouldContinue && loadScript(ctx, "test/demo.js");
+#else
+	// not currently embedding the demo program since it's just for test purposes
+	shouldContinue = 0;
+#endif
+
+	FrameScheduler frameScheduler;
+	startFrameScheduler(&frameScheduler);
+
+	while (shouldContinue && !isTestFinished) {
+		updateSystem(ctx, &frameScheduler);
+	}
+
+	destroyCountingHeap(ctx);
+}
+
+void tuneTool() {
+	SDL_SetWindowTitle(window, "TUNE DEMO");
+	recordInputProgram(INPUT_PROGRAM_TUNE_TOOL);
+
+	duk_context* ctx = createCountingHeap();
+
+	initSystem(ctx);
+
+	// load tune tool program
+#ifdef BUILD_DEBUG
+	shouldContinue = shouldContinue && loadScript(ctx, "tune/dialog_demo.js");
+	shouldContinue = shouldContinue && loadScript(ctx, "tune/tool_demo.js");
+	shouldContinue = shouldContinue && loadScript(ctx, "tune/tune.js");
+	shouldContinue = shouldContinue && loadFile(ctx, "tune/tune.bitsy", "__bitsybox_game_data__");
+#else
+	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, dialog_demo_js);
+	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, tool_demo_js);
+	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, tune_js);
+	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, tune_bitsy, "__bitsybox_game_data__");
+#endif
+
+	int shouldQuitToolDemo = 0;
+
+	FrameScheduler frameScheduler;
+	startFrameScheduler(&frameScheduler);
+
+	while (shouldContinue && !shouldQuitToolDemo) {
+		// update mouse state
+		int isMouseOnScreen = (mouseX >= 0 && mouseX < BITSY_VIDEO_SIZE && mouseY >= 0 && mouseY < BITSY_VIDEO_SIZE);
+		duk_push_boolean(ctx, isLeftMouseDown && isMouseOnScreen);
+		duk_put_global_string(ctx, "__bitsybox_mouse_down__");
+
+		duk_push_int(ctx, mouseX);
+		duk_put_global_string(ctx, "__bitsybox_mouse_x__");
+
+		duk_push_int(ctx, mouseY);
+		duk_put_global_string(ctx, "__bitsybox_mouse_y__");
+
+		duk_push_boolean(ctx, (isButtonLAlt || isButtonRAlt));
+		duk_put_global_string(ctx, "__bitsybox_mouse_alt__");
+
+		duk_push_boolean(ctx, isMouseOnScreen);
+		duk_put_global_string(ctx, "__bitsybox_mouse_hover__");
+
+		updateSystem(ctx, &frameScheduler);
+
+		// check if it's time to quit
+		duk_peval_string(ctx, "__bitsybox_should_quit_tool_demo__");
+		shouldQuitToolDemo = duk_get_boolean(ctx, -1);
+		duk_pop(ctx);
+	}
+
+	destroyCountingHeap(ctx);
+}
+
+/* # WAV RENDERING */
+
+// `--render-wav` runs the audio engine without a sound card (or a window) and writes
+// a tune or blip to a 16-bit WAV file as fast as it can be generated
+#define RENDER_FRAME_MS 10 // how often the engine is updated (in simulated time)
+#define RENDER_SECONDS_MAX 600 // stop blips that never end
+
+char renderWavPath[PATH_MAX] = "";
+char renderGamePath[PATH_MAX] = "";
+char renderSoundId[256] = "";
+int isRenderingBlip = 0;
+float renderSeconds = 0.0f; // zero renders one loop of a tune, or until a blip ends
+
+void writeWavHeader(FILE* f, int sampleRate, uint32_t sampleCount) {
+	uint32_t dataSize = sampleCount * 2 * sizeof(int16_t);
+
+	fwrite("RIFF", 1, 4, f);
+	writeLittleEndian(f, 36 + dataSize, 4);
+	fwrite("WAVE", 1, 4, f);
+
+	// stereo 16-bit PCM
+	fwrite("fmt ", 1, 4, f);
+	writeLittleEndian(f, 16, 4);
+	writeLittleEndian(f, 1, 2);
+	writeLittleEndian(f, 2, 2);
+	writeLittleEndian(f, sampleRate, 4);
+	writeLittleEndian(f, sampleRate * 2 * sizeof(int16_t), 4);
+	writeLittleEndian(f, 2 * sizeof(int16_t), 2);
+	writeLittleEndian(f, 16, 2);
+
+	fwrite("data", 1, 4, f);
+	writeLittleEndian(f, dataSize, 4);
+}
+
+int isAudioIdle() {
+	if (isTunePlaying || scheduledCommandCount > 0 || SDL_AtomicGet(&audioQueueHead) != SDL_AtomicGet(&audioQueueTail)) {
+		return 0;
+	}
+
+	for (int i = 0; i < SOUND_CHANNEL_COUNT; i++) {
+		if (soundChannels[i].duration > 0) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
 
-	duk_push_c_function(ctx, bitsyLoop, 1);
-	duk_put_prop_string(ctx, bitsySystemIdx, "loop");
+// evaluates `script` and returns its result as a number (or `defaultValue` if it fails)
+double evalRenderScript(duk_context* ctx, const char* script, double defaultValue) {
+	double result = defaultValue;
 
-	// BITSY SYSTEM
+	if (duk_peval_string(ctx, script) != 0) {
+		printf("Render Error: %s\n", duk_safe_to_string(ctx, -1));
+		shouldContinue = 0;
+	}
+	else if (duk_is_number(ctx, -1)) {
+		result = duk_get_number(ctx, -1);
+	}
 
-	// assign name to system object
-	duk_put_global_string(ctx, "bitsy");
+	duk_pop(ctx);
+
+	return result;
 }
 
-/* # INITIALIZATION */
+int renderWav() {
+	duk_context* ctx = createCountingHeap();
 
-void resetMemoryAndTextures() {
-	// delete any textures
-	for (int i = 0; i < TEXTURE_MAX; i++) {
-		if (textures[i] != NULL) {
-			SDL_DestroyTexture(textures[i]);
-			textures[i] = NULL;
+	// a render is a one-off, so it doesn't leave a world cache behind
+	isWorldCacheEnabled = 0;
+
+	// only the sound parts of the engine are used, so there's no need for textures
+	initializeMemoryBlocks();
+	initBitsyInterface(ctx);
+	shouldContinue = shouldContinue && loadEngine(ctx);
+	shouldContinue = shouldContinue && loadFile(ctx, renderGamePath, "__bitsybox_game_data__");
+
+	duk_push_string(ctx, renderSoundId);
+	duk_put_global_string(ctx, "__bitsybox_render_id__");
+
+	// loading the world starts the first room's tune, which shouldn't be part of the render
+	evalRenderScript(ctx, "loadWorldFromGameData(bitsy.getGameData()); soundPlayer.stopTune();", 0);
+
+	// the length of the render in samples
+	int sampleTotal = (int) (renderSeconds * audioSampleRate);
+	int tuneLoopEnd = 0; // the sample where one loop of the tune ends (zero once it's stopped)
+
+	if (isRenderingBlip) {
+		evalRenderScript(
+			ctx,
+			"if (blip[__bitsybox_render_id__] === undefined) { throw 'no blip with id ' + __bitsybox_render_id__; }"
+			"soundPlayer.playBlip(blip[__bitsybox_render_id__]);",
+			0);
+	}
+	else {
+		evalRenderScript(
+			ctx,
+			"if (tune[__bitsybox_render_id__] === undefined) { throw 'no tune with id ' + __bitsybox_render_id__; }"
+			"soundPlayer.playTune(tune[__bitsybox_render_id__]);",
+			0);
+
+		if (sampleTotal <= 0) {
+			// one loop, rounded the same way as the steps of the tune sequencer. the first step plays
+			// one step after the tune starts, so the loop ends a step later than its length (and then
+			// the render runs on until the notes the tune is still holding have rung out)
+			int stepCount = (int) evalRenderScript(ctx, "soundPlayer.getTuneLength().steps;", 0);
+			double stepTime = evalRenderScript(ctx, "soundPlayer.getTuneLength().beat;", 0);
+			tuneLoopEnd = (stepCount + 1) * millisecondsToSamples(stepTime);
 		}
 	}
 
-	// initialize system memory
-	initializeMemoryBlocks();
+	if (sampleTotal <= 0) {
+		sampleTotal = RENDER_SECONDS_MAX * audioSampleRate;
+	}
 
-	// video mode texture
-	textures[BITSY_VIDEO] = SDL_CreateTexture(
-		renderer,
-		SDL_PIXELFORMAT_RGB888,
-		SDL_TEXTUREACCESS_TARGET,
-		(BITSY_VIDEO_SIZE * renderScale),
-		(BITSY_VIDEO_SIZE * renderScale));
-	allocateMemoryBlock(BITSY_VIDEO, BITSY_VIDEO_SIZE * BITSY_VIDEO_SIZE);
+	FILE* f = shouldContinue ? fopen(renderWavPath, "wb") : NULL;
 
-	// map mode textures
-	textures[BITSY_MAP1] = SDL_CreateTexture(
-		renderer,
-		SDL_PIXELFORMAT_RGB888,
-		SDL_TEXTUREACCESS_TARGET,
-		(BITSY_VIDEO_SIZE * renderScale),
-		(BITSY_VIDEO_SIZE * renderScale));
-	allocateMemoryBlock(BITSY_MAP1, BITSY_MAP_SIZE * BITSY_MAP_SIZE);
+	if (f == NULL) {
+		if (shouldContinue) {
+			printf("Error writing %s\n", renderWavPath);
+		}
 
-	textures[BITSY_MAP2] = SDL_CreateTexture(
-		renderer,
-		SDL_PIXELFORMAT_RGBA8888,
-		SDL_TEXTUREACCESS_TARGET,
-		(BITSY_VIDEO_SIZE * renderScale),
-		(BITSY_VIDEO_SIZE * renderScale));
-	allocateMemoryBlock(BITSY_MAP2, BITSY_MAP_SIZE * BITSY_MAP_SIZE);
-	// enable alpha blending for the foreground tile map texture
-	SDL_SetTextureBlendMode(textures[BITSY_MAP2], SDL_BLENDMODE_BLEND);
+		destroyCountingHeap(ctx);
+		return 0;
+	}
 
-	// create textbox texture
-	textures[BITSY_TEXTBOX] = SDL_CreateTexture(
-		renderer,
-		SDL_PIXELFORMAT_RGB888,
-		SDL_TEXTUREACCESS_TARGET,
-		(textboxWidth * textboxRenderScale),
-		(textboxHeight * textboxRenderScale));
-	allocateMemoryBlock(BITSY_TEXTBOX, textboxWidth * textboxHeight);
-}
+	// the header is written again at the end once the real length is known
+	writeWavHeader(f, audioSampleRate, 0);
 
-void loadEngine(duk_context* ctx) {
-#ifdef BUILD_DEBUG
-	// load engine
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/world.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/sound.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/font.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/transition.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/script.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/dialog.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/renderer.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "bitsy/engine/bitsy.js");
-	// load default font
-	shouldContinue = shouldContinue && loadFile(ctx, "bitsy/font/ascii_small.bitsyfont", "__bitsybox_default_font__");
-#else
-	// load engine
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, world_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, sound_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, font_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, transition_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, script_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, dialog_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, renderer_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, bitsy_js);
-	// load default font
-	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, ascii_small_bitsyfont, "__bitsybox_default_font__");
-#endif
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	float frameSamples[AUDIO_CHUNK_SIZE * 2];
+	int frameLength = millisecondsToSamples(RENDER_FRAME_MS);
+	int sampleCount = 0;
+	int isBlipFinished = 0;
+
+	// the engine sees the same fixed delta time on every update, so renders are repeatable
+	duk_push_int(ctx, RENDER_FRAME_MS);
+	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+
+	while (shouldContinue && sampleCount < sampleTotal && !isBlipFinished) {
+		if (tuneLoopEnd > 0 && sampleCount >= tuneLoopEnd) {
+			// the stop is due on the same sample as the next loop's first step, and commands go first
+			evalRenderScript(ctx, "soundPlayer.stopTune();", 0);
+			tuneLoopEnd = 0;
+
+			int tailLength = 0;
+			for (int i = 0; i < SOUND_CHANNEL_COUNT; i++) {
+				tailLength = soundChannels[i].duration > tailLength ? soundChannels[i].duration : tailLength;
+			}
+
+			sampleTotal = sampleCount + tailLength < sampleTotal ? sampleCount + tailLength : sampleTotal;
+		}
+
+		evalRenderScript(ctx, "soundPlayer.update(__bitsybox_delta_time__);", 0);
+
+		scheduleAudioCommands();
+
+		int frameEnd = sampleCount + frameLength < sampleTotal ? sampleCount + frameLength : sampleTotal;
+
+		if (tuneLoopEnd > 0 && frameEnd > tuneLoopEnd) {
+			frameEnd = tuneLoopEnd;
+		}
+
+		while (sampleCount < frameEnd) {
+			int chunkSize = (frameEnd - sampleCount) < AUDIO_CHUNK_SIZE ? (frameEnd - sampleCount) : AUDIO_CHUNK_SIZE;
+			generateAudio(frameSamples, chunkSize);
+
+			// WAV data is little endian
+			for (int i = 0; i < chunkSize * 2; i++) {
+				int16_t pcmSample = (int16_t) lrintf(frameSamples[i] * 32767.0f);
+				writeLittleEndian(f, (uint16_t) pcmSample, 2);
+			}
+
+			sampleCount += chunkSize;
+		}
+
+		SDL_AtomicSet(&audioClock, (int) audioStep);
+
+		if (isRenderingBlip && renderSeconds <= 0.0f) {
+			isBlipFinished = !evalRenderScript(ctx, "soundPlayer.isBlipPlaying() ? 1 : 0;", 0) && isAudioIdle();
+		}
+	}
+
+	double renderTime = (double) (SDL_GetPerformanceCounter() - startTime) / SDL_GetPerformanceFrequency();
+
+	fseek(f, 0, SEEK_SET);
+	writeWavHeader(f, audioSampleRate, sampleCount);
+	fclose(f);
+
+	printf(
+		"Rendered %.2f seconds of audio to %s in %.3f seconds\n",
+		(double) sampleCount / audioSampleRate,
+		renderWavPath,
+		renderTime);
+
+	destroyCountingHeap(ctx);
+
+	return shouldContinue;
 }
 
-void initSystem(duk_context* ctx) {
-	resetMemoryAndTextures();
-	initBitsyInterface(ctx);
-	loadEngine(ctx);
+/* # HEADLESS */
+
+// `--headless=FILE` runs a game for a fixed number of frames without a window or an audio device
+// (skipping the boot menu), and writes the hashes of every composed frame to `--hash-file` so runs
+// can be compared on machines with no display. the input comes from `--replay` or `--input-script`,
+// and with `--golden` the hashes are checked against a hash file from an earlier run
+char headlessGamePath[PATH_MAX] = "";
+int headlessFrameCount = 600;
+char hashFilePath[PATH_MAX] = "";
+char goldenFilePath[PATH_MAX] = "";
+char inputScriptPath[PATH_MAX] = "";
+
+/* ## FRAMEBUFFER */
+
+// frames are composed on the CPU at twice the bitsy resolution (so the hi-res textbox fits)
+#define FRAMEBUFFER_SCALE 2
+#define FRAMEBUFFER_SIZE (BITSY_VIDEO_SIZE * FRAMEBUFFER_SCALE)
+
+// (one per thread, so `--validate` workers can compose frames at the same time)
+_Thread_local uint8_t framebuffer[FRAMEBUFFER_SIZE * FRAMEBUFFER_SIZE * 3]; // RGB
+
+void fillFramebufferRect(int x, int y, int width, int height, Color color) {
+	int left = x > 0 ? x : 0;
+	int top = y > 0 ? y : 0;
+	int right = (x + width) < FRAMEBUFFER_SIZE ? (x + width) : FRAMEBUFFER_SIZE;
+	int bottom = (y + height) < FRAMEBUFFER_SIZE ? (y + height) : FRAMEBUFFER_SIZE;
+
+	for (int pixelY = top; pixelY < bottom; pixelY++) {
+		uint8_t* pixel = &framebuffer[(pixelY * FRAMEBUFFER_SIZE + left) * 3];
+
+		for (int pixelX = left; pixelX < right; pixelX++) {
+			pixel[0] = color.r;
+			pixel[1] = color.g;
+			pixel[2] = color.b;
+			pixel += 3;
+		}
+	}
 }
 
-/* # UPDATE */
+// draws a tile map layer the same way the tile map textures are drawn
+void composeTileMap(FrameSnapshot* frame, int mapBlock) {
+	int backgroundColorIndex = 16;
+	Color bgColor = frame->palette[backgroundColorIndex];
+	int tilePixelSize = BITSY_TILE_SIZE * FRAMEBUFFER_SCALE;
 
-void updateInput() {
-	if (SDL_PollEvent(&event)) {
-		if (event.type == SDL_QUIT) {
-			shouldContinue = 0;
+	if (isFrameBlockEmpty(frame, mapBlock)) {
+		return;
+	}
+
+	MemoryBlock mapMemory = frame->memory[mapBlock];
+	for (int i = 0; i < mapMemory.size; i++) {
+		int tileId = mapMemory.data[i];
+
+		if (tileId < BITSY_TILE_START || tileId >= MEMORY_BLOCK_MAX || isFrameBlockEmpty(frame, tileId)) {
+			continue;
 		}
-		else if (event.type == SDL_WINDOWEVENT) {
-			if (event.window.event == SDL_WINDOWEVENT_RESIZED) {
-				didWindowResizeThisFrame = 1;
+
+		int tileLeft = (i % BITSY_MAP_SIZE) * tilePixelSize;
+		int tileTop = (i / BITSY_MAP_SIZE) * tilePixelSize;
+
+		// tiles are opaque
+		fillFramebufferRect(tileLeft, tileTop, tilePixelSize, tilePixelSize, bgColor);
+
+		MemoryBlock tileMemory = frame->memory[tileId];
+		for (int pixelIndex = 0; pixelIndex < tileMemory.size; pixelIndex++) {
+			int pixelColorIndex = tileMemory.data[pixelIndex];
+
+			if (pixelColorIndex != backgroundColorIndex) {
+				fillFramebufferRect(
+					tileLeft + (pixelIndex % BITSY_TILE_SIZE) * FRAMEBUFFER_SCALE,
+					tileTop + (pixelIndex / BITSY_TILE_SIZE) * FRAMEBUFFER_SCALE,
+					FRAMEBUFFER_SCALE,
+					FRAMEBUFFER_SCALE,
+					frame->palette[pixelColorIndex]);
 			}
 		}
-		else if (event.type == SDL_KEYDOWN) {
-			if (event.key.keysym.sym == SDLK_UP) {
-				isButtonUp = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_DOWN) {
-				isButtonDown = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_LEFT) {
-				isButtonLeft = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_RIGHT) {
-				isButtonRight = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_w) {
-				isButtonW = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_a) {
-				isButtonA = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_s) {
-				isButtonS = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_d) {
-				isButtonD = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_r) {
-				isButtonR = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_SPACE) {
-				isButtonSpace = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_RETURN) {
-				isButtonReturn = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_ESCAPE) {
-				isButtonEscape = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_LCTRL) {
-				isButtonLCtrl = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_RCTRL) {
-				isButtonRCtrl = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_LALT) {
-				isButtonLAlt = 1;
-			}
-			else if (event.key.keysym.sym == SDLK_RALT) {
-				isButtonRAlt = 1;
+	}
+}
+
+// the CPU version of `renderFrame` (without any window letterboxing)
+void composeFramebuffer(FrameSnapshot* frame) {
+	int backgroundColorIndex = 16;
+
+	fillFramebufferRect(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, frame->palette[backgroundColorIndex]);
+
+	if (frame->graphicsMode == BITSY_GFX_VIDEO) {
+		if (!isFrameBlockEmpty(frame, BITSY_VIDEO)) {
+			MemoryBlock videoMemory = frame->memory[BITSY_VIDEO];
+			for (int i = 0; i < videoMemory.size; i++) {
+				int pixelColorIndex = videoMemory.data[i];
+
+				if (pixelColorIndex != backgroundColorIndex) {
+					fillFramebufferRect(
+						(i % BITSY_VIDEO_SIZE) * FRAMEBUFFER_SCALE,
+						(i / BITSY_VIDEO_SIZE) * FRAMEBUFFER_SCALE,
+						FRAMEBUFFER_SCALE,
+						FRAMEBUFFER_SCALE,
+						frame->palette[pixelColorIndex]);
+				}
 			}
 		}
-		else if (event.type == SDL_KEYUP) {
-			if (event.key.keysym.sym == SDLK_UP) {
-				isButtonUp = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_DOWN) {
-				isButtonDown = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_LEFT) {
-				isButtonLeft = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_RIGHT) {
-				isButtonRight = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_RIGHT) {
-				isButtonRight = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_w) {
-				isButtonW = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_a) {
-				isButtonA = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_s) {
-				isButtonS = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_d) {
-				isButtonD = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_r) {
-				isButtonR = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_SPACE) {
-				isButtonSpace = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_RETURN) {
-				isButtonReturn = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_ESCAPE) {
-				isButtonEscape = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_LCTRL) {
-				isButtonLCtrl = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_RCTRL) {
-				isButtonRCtrl = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_LALT) {
-				isButtonLAlt = 0;
-			}
-			else if (event.key.keysym.sym == SDLK_RALT) {
-				isButtonRAlt = 0;
+
+		return;
+	}
+
+	composeTileMap(frame, BITSY_MAP1);
+	composeTileMap(frame, BITSY_MAP2);
+
+	if (frame->isTextboxVisible) {
+		int textboxPixelSize = (frame->textboxRenderScale * FRAMEBUFFER_SCALE) / renderScale;
+		int textboxLeft = frame->textboxX * FRAMEBUFFER_SCALE;
+		int textboxTop = frame->textboxY * FRAMEBUFFER_SCALE;
+
+		fillFramebufferRect(
+			textboxLeft,
+			textboxTop,
+			frame->textboxWidth * textboxPixelSize,
+			frame->textboxHeight * textboxPixelSize,
+			frame->palette[0]);
+
+		if (!isFrameBlockEmpty(frame, BITSY_TEXTBOX) && frame->textboxWidth > 0) {
+			MemoryBlock textboxMemory = frame->memory[BITSY_TEXTBOX];
+			for (int i = 0; i < textboxMemory.size; i++) {
+				int pixelColorIndex = textboxMemory.data[i];
+
+				if (pixelColorIndex > 0) {
+					fillFramebufferRect(
+						textboxLeft + (i % frame->textboxWidth) * textboxPixelSize,
+						textboxTop + (i / frame->textboxWidth) * textboxPixelSize,
+						textboxPixelSize,
+						textboxPixelSize,
+						frame->palette[pixelColorIndex]);
+				}
 			}
 		}
-		else if (event.type == SDL_CONTROLLERDEVICEADDED) {
-			SDL_GameControllerOpen(event.cdevice.which);
+	}
+}
+
+/* ## FRAME HASHES */
+
+// besides the whole frame, each cell of a grid over the frame is hashed on its own, so a
+// difference from the golden frames can be narrowed down to part of the screen. a hash file
+// has a line per frame: the frame number, the frame hash, then the cell hashes row by row
+#define HASH_GRID_SIZE 4
+#define HASH_CELL_SIZE (FRAMEBUFFER_SIZE / HASH_GRID_SIZE)
+#define HASH_CELL_COUNT (HASH_GRID_SIZE * HASH_GRID_SIZE)
+
+typedef struct FrameHashes {
+	uint64_t frame;
+	uint64_t cells[HASH_CELL_COUNT];
+} FrameHashes;
+
+void hashFramebuffer(FrameHashes* hashes) {
+	hashes->frame = hashBytes(HASH_SEED, framebuffer, sizeof(framebuffer));
+
+	for (int i = 0; i < HASH_CELL_COUNT; i++) {
+		int cellLeft = (i % HASH_GRID_SIZE) * HASH_CELL_SIZE;
+		int cellTop = (i / HASH_GRID_SIZE) * HASH_CELL_SIZE;
+
+		hashes->cells[i] = HASH_SEED;
+		for (int pixelY = cellTop; pixelY < cellTop + HASH_CELL_SIZE; pixelY++) {
+			uint8_t* row = &framebuffer[(pixelY * FRAMEBUFFER_SIZE + cellLeft) * 3];
+			hashes->cells[i] = hashBytes(hashes->cells[i], row, HASH_CELL_SIZE * 3);
+		}
+	}
+}
+
+void writeFrameHashes(FILE* f, int frameIndex, FrameHashes* hashes) {
+	fprintf(f, "%d %016" PRIx64, frameIndex, hashes->frame);
+
+	for (int i = 0; i < HASH_CELL_COUNT; i++) {
+		fprintf(f, " %016" PRIx64, hashes->cells[i]);
+	}
+
+	fprintf(f, "\n");
+}
+
+// returns 0 at the end of the file (or if the line isn't a full set of hashes)
+int readFrameHashes(FILE* f, int* frameIndex, FrameHashes* hashes) {
+	if (fscanf(f, "%d %" SCNx64, frameIndex, &hashes->frame) != 2) {
+		return 0;
+	}
+
+	for (int i = 0; i < HASH_CELL_COUNT; i++) {
+		if (fscanf(f, " %" SCNx64, &hashes->cells[i]) != 1) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+// compares a frame with its golden hashes, printing where it differs the first time that happens
+int checkGoldenFrame(FILE* goldenFile, int frameIndex, FrameHashes* hashes, int isFirstDifference) {
+	int goldenFrameIndex = 0;
+	FrameHashes goldenHashes;
+
+	if (!readFrameHashes(goldenFile, &goldenFrameIndex, &goldenHashes) || goldenFrameIndex != frameIndex) {
+		if (isFirstDifference) {
+			printf("Frame %d isn't in the golden file %s\n", frameIndex, goldenFilePath);
 		}
-		else if (event.type == SDL_CONTROLLERBUTTONDOWN) {
-			if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_UP) {
-				isButtonPadUp = 1;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_DOWN) {
-				isButtonPadDown = 1;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_LEFT) {
-				isButtonPadLeft = 1;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_RIGHT) {
-				isButtonPadRight = 1;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_A) {
-				isButtonPadA = 1;
+
+		return 0;
+	}
+
+	if (hashes->frame == goldenHashes.frame) {
+		return 1;
+	}
+
+	if (isFirstDifference) {
+		// the bounding box of the cells that changed (in bitsy pixels)
+		int left = BITSY_VIDEO_SIZE;
+		int top = BITSY_VIDEO_SIZE;
+		int right = 0;
+		int bottom = 0;
+		int cellSize = HASH_CELL_SIZE / FRAMEBUFFER_SCALE;
+
+		for (int i = 0; i < HASH_CELL_COUNT; i++) {
+			if (hashes->cells[i] != goldenHashes.cells[i]) {
+				int cellLeft = (i % HASH_GRID_SIZE) * cellSize;
+				int cellTop = (i / HASH_GRID_SIZE) * cellSize;
+
+				left = cellLeft < left ? cellLeft : left;
+				top = cellTop < top ? cellTop : top;
+				right = (cellLeft + cellSize) > right ? (cellLeft + cellSize) : right;
+				bottom = (cellTop + cellSize) > bottom ? (cellTop + cellSize) : bottom;
 			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_B) {
-				isButtonPadB = 1;
+		}
+
+		printf(
+			"Frame %d differs from the golden frame in the region x %d-%d, y %d-%d\n",
+			frameIndex,
+			left,
+			right - 1,
+			top,
+			bottom - 1);
+	}
+
+	return 0;
+}
+
+/* ## INPUT SCRIPT */
+
+// an input script is a text file where each line is a frame number followed by the buttons
+// held from that frame on (until the next line), e.g. "30 right ok" ("#" starts a comment)
+typedef struct InputScriptStep {
+	int frame;
+	uint32_t buttons; // in the same layout as `getButtonStates`
+} InputScriptStep;
+
+typedef struct InputScriptButton {
+	const char* name;
+	int code; // the key that the button stands for
+	int bitsyCode; // and the bitsy button that key is read as
+} InputScriptButton;
+
+InputScriptButton inputScriptButtons[] = {
+	{ "up", SDLK_UP, BITSY_BTN_UP },
+	{ "down", SDLK_DOWN, BITSY_BTN_DOWN },
+	{ "left", SDLK_LEFT, BITSY_BTN_LEFT },
+	{ "right", SDLK_RIGHT, BITSY_BTN_RIGHT },
+	{ "ok", SDLK_SPACE, BITSY_BTN_OK },
+	{ "menu", SDLK_ESCAPE, BITSY_BTN_MENU },
+};
+
+#define INPUT_SCRIPT_BUTTON_COUNT (int) (sizeof(inputScriptButtons) / sizeof(InputScriptButton))
+
+InputScriptStep* inputScriptSteps = NULL;
+int inputScriptStepCount = 0;
+int inputScriptNextStep = 0;
+
+// returns the button state bit for `name`, or 0 if there's no button with that name
+uint32_t inputScriptButtonBit(const char* name) {
+	for (int i = 0; i < INPUT_SCRIPT_BUTTON_COUNT; i++) {
+		if (strcmp(name, inputScriptButtons[i].name) != 0) {
+			continue;
+		}
+
+		for (int j = 0; j < KEY_BINDING_COUNT; j++) {
+			if (keyBindings[j].code == inputScriptButtons[i].code) {
+				return 1u << j;
 			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_X) {
-				isButtonPadX = 1;
+		}
+	}
+
+	return 0;
+}
+
+int loadInputScript() {
+	FILE* f = fopen(inputScriptPath, "r");
+
+	if (f == NULL) {
+		printf("Error reading %s\n", inputScriptPath);
+		return 0;
+	}
+
+	char line[256];
+	int lineNumber = 0;
+	int stepCapacity = 0;
+	int isValid = 1;
+
+	while (isValid && fgets(line, sizeof(line), f) != NULL) {
+		lineNumber++;
+
+		char* comment = strchr(line, '#');
+		if (comment != NULL) {
+			*comment = '\0';
+		}
+
+		char* token = strtok(line, " \t\r\n");
+		if (token == NULL) {
+			continue;
+		}
+
+		InputScriptStep step = { atoi(token), 0 };
+
+		while ((token = strtok(NULL, " \t\r\n")) != NULL) {
+			uint32_t bit = inputScriptButtonBit(token);
+
+			if (bit == 0) {
+				printf("%s:%d: unknown button \"%s\"\n", inputScriptPath, lineNumber, token);
+				isValid = 0;
 			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_Y) {
-				isButtonPadY = 1;
+
+			step.buttons |= bit;
+		}
+
+		if (inputScriptStepCount > 0 && step.frame < inputScriptSteps[inputScriptStepCount - 1].frame) {
+			printf("%s:%d: frames must be in order\n", inputScriptPath, lineNumber);
+			isValid = 0;
+		}
+
+		if (inputScriptStepCount >= stepCapacity) {
+			stepCapacity = stepCapacity > 0 ? stepCapacity * 2 : 64;
+			inputScriptSteps = realloc(inputScriptSteps, stepCapacity * sizeof(InputScriptStep));
+		}
+
+		inputScriptSteps[inputScriptStepCount++] = step;
+	}
+
+	fclose(f);
+
+	return isValid;
+}
+
+// converts the button states of an input script step to scripted bitsy buttons
+uint32_t inputScriptBitsyButtons(uint32_t buttons) {
+	uint32_t bitsyButtons = 0;
+
+	for (int i = 0; i < INPUT_SCRIPT_BUTTON_COUNT; i++) {
+		if ((buttons & inputScriptButtonBit(inputScriptButtons[i].name)) != 0) {
+			bitsyButtons |= 1u << inputScriptButtons[i].bitsyCode;
+		}
+	}
+
+	return bitsyButtons;
+}
+
+void scriptInputFrame(int frame) {
+	while (inputScriptNextStep < inputScriptStepCount && inputScriptSteps[inputScriptNextStep].frame <= frame) {
+		setButtonStates(inputScriptSteps[inputScriptNextStep].buttons);
+		inputScriptNextStep++;
+	}
+}
+
+/* ## HEADLESS LOOP */
+
+// there's no audio device to play the sound, but it's still generated at the same pace
+void generateFrameAudio(int updateCount) {
+	float frameSamples[AUDIO_CHUNK_SIZE * 2];
+
+	scheduleAudioCommands();
+
+	int sampleCount = updateCount * millisecondsToSamples(FRAME_STEP_MS);
+	while (sampleCount > 0) {
+		int chunkSize = sampleCount < AUDIO_CHUNK_SIZE ? sampleCount : AUDIO_CHUNK_SIZE;
+		generateAudio(frameSamples, chunkSize);
+		sampleCount -= chunkSize;
+	}
+
+	SDL_AtomicSet(&audioClock, (int) audioStep);
+}
+
+int runHeadless() {
+	// the world is always parsed, so a `--golden` run catches changes to the parser too
+	isWorldCacheEnabled = 0;
+
+	if (inputScriptPath[0] != '\0' && !loadInputScript()) {
+		return 0;
+	}
+
+	// a recording starts in the boot menu, so only its first game is replayed
+	if (inputReplayFile != NULL) {
+		if (!skipToInputProgram(INPUT_PROGRAM_GAME)) {
+			printf("%s doesn't have a game in it\n", inputReplayPath);
+			return 0;
+		}
+
+		isInputReplayOneProgram = 1;
+	}
+
+	FILE* hashFile = NULL;
+
+	if (hashFilePath[0] != '\0') {
+		hashFile = fopen(hashFilePath, "w");
+
+		if (hashFile == NULL) {
+			printf("Error writing %s\n", hashFilePath);
+			return 0;
+		}
+	}
+
+	FILE* goldenFile = NULL;
+	int goldenDifferenceCount = 0;
+	int firstGoldenDifference = -1;
+
+	if (goldenFilePath[0] != '\0') {
+		goldenFile = fopen(goldenFilePath, "r");
+
+		if (goldenFile == NULL) {
+			printf("Error reading %s\n", goldenFilePath);
+
+			if (hashFile != NULL) {
+				fclose(hashFile);
 			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_START) {
-				isButtonPadStart = 1;
+
+			return 0;
+		}
+	}
+
+	duk_context* ctx = createCountingHeap();
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	initSystem(ctx);
+	shouldContinue = shouldContinue && loadFile(ctx, headlessGamePath, "__bitsybox_game_data__");
+
+	double loadMs = ticksToMs(SDL_GetPerformanceCounter() - startTime);
+	double updateMs = 0;
+	double composeMs = 0;
+	double audioMs = 0;
+
+	FrameSnapshot* frame = &frameSnapshots[0];
+	int frameCount = 0;
+
+	duk_push_number(ctx, FRAME_STEP_MS);
+	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+
+	while (shouldContinue && frameCount < headlessFrameCount) {
+		int updateCount = 1;
+
+		if (inputReplayFile != NULL) {
+			if (!replayInputFrame(&updateCount)) {
+				break;
 			}
 		}
-		else if (event.type == SDL_CONTROLLERBUTTONUP) {
-			if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_UP) {
-				isButtonPadUp = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_DOWN) {
-				isButtonPadDown = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_LEFT) {
-				isButtonPadLeft = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_DPAD_RIGHT) {
-				isButtonPadRight = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_A) {
-				isButtonPadA = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_B) {
-				isButtonPadB = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_X) {
-				isButtonPadX = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_Y) {
-				isButtonPadY = 0;
-			}
-			else if (event.cbutton.button == SDL_CONTROLLER_BUTTON_START) {
-				isButtonPadStart = 0;
+		else {
+			scriptInputFrame(frameCount);
+		}
+
+		Uint64 time = SDL_GetPerformanceCounter();
+
+		runEngineUpdates(ctx, updateCount);
+		captureFrame(frame, 0);
+
+		Uint64 updateEndTime = SDL_GetPerformanceCounter();
+		updateMs += ticksToMs(updateEndTime - time);
+
+		composeFramebuffer(frame);
+
+		FrameHashes hashes;
+		hashFramebuffer(&hashes);
+
+		if (hashFile != NULL) {
+			writeFrameHashes(hashFile, frameCount, &hashes);
+		}
+
+		if (goldenFile != NULL && !checkGoldenFrame(goldenFile, frameCount, &hashes, goldenDifferenceCount == 0)) {
+			if (goldenDifferenceCount == 0) {
+				firstGoldenDifference = frameCount;
 			}
+
+			goldenDifferenceCount++;
 		}
-	}
 
-	// get mouse state
-	int windowMouseX = 0;
-	int windowMouseY = 0;
-	isLeftMouseDown = SDL_GetMouseState(&windowMouseX, &windowMouseY) & SDL_BUTTON(1);
+		Uint64 composeEndTime = SDL_GetPerformanceCounter();
+		composeMs += ticksToMs(composeEndTime - updateEndTime);
 
-	// normalize mouse position to bitsy scale
-	int screenSize = (windowWidth <= windowHeight) ? windowWidth : windowHeight;
-	int screenLeft = (windowWidth / 2) - (screenSize / 2);
-	int screenTop = (windowHeight / 2) - (screenSize / 2);
-	float pixelRatio = ((float) BITSY_VIDEO_SIZE) / ((float) screenSize);
-	mouseX = floor((windowMouseX - screenLeft) * pixelRatio);
-	mouseY = floor((windowMouseY - screenTop) * pixelRatio);
+		generateFrameAudio(updateCount);
 
-	// toggle fullscreen
-	int prevFrameFullscreenShortcut = isFullscreenShortcut;
-	isFullscreenShortcut = (isButtonLAlt || isButtonRAlt) && isButtonReturn;
+		Uint64 audioEndTime = SDL_GetPerformanceCounter();
+		audioMs += ticksToMs(audioEndTime - composeEndTime);
 
-	if (isFullscreenShortcut && !prevFrameFullscreenShortcut) {
-		isFullscreen = (isFullscreen == 0 ? 1 : 0);
+		traceSpan("frame", "update", time, updateEndTime);
+		traceSpan("frame", "compose", updateEndTime, composeEndTime);
+		traceSpan("frame", "audio", composeEndTime, audioEndTime);
+		traceSpan("frame", "frame", time, audioEndTime);
+		traceCounter("javascript heap bytes", getHeapStats(ctx)->bytes);
+		flushTrace();
 
-		SDL_ShowCursor(!isFullscreen);
-		SDL_SetWindowFullscreen(window, isFullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0);
+		endCallStatsFrame();
+		updateLog();
 
-		if (!isFullscreen) {
-			SDL_SetWindowSize(window, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale));
+		frameCount++;
+	}
+
+	double totalMs = ticksToMs(SDL_GetPerformanceCounter() - startTime);
+
+	if (hashFile != NULL) {
+		fclose(hashFile);
+	}
+
+	if (goldenFile != NULL) {
+		int goldenFrameIndex = 0;
+		FrameHashes goldenHashes;
+
+		// the golden run shouldn't have gone on any longer either
+		if (goldenDifferenceCount == 0 && readFrameHashes(goldenFile, &goldenFrameIndex, &goldenHashes)) {
+			printf("The golden file %s has more frames (this run stopped after %d)\n", goldenFilePath, frameCount);
+			goldenDifferenceCount++;
 		}
 
-		didWindowResizeThisFrame = 1;
+		fclose(goldenFile);
+	}
+
+	destroyCountingHeap(ctx);
+
+	printf("Ran %d frames of %s in %.3f seconds (%.3f ms loading)\n", frameCount, headlessGamePath, totalMs / 1000.0, loadMs);
+
+	if (frameCount > 0) {
+		printf(
+			"Per frame: %.3f ms update, %.3f ms compose, %.3f ms audio\n",
+			updateMs / frameCount,
+			composeMs / frameCount,
+			audioMs / frameCount);
+	}
+
+	if (goldenFile != NULL) {
+		if (goldenDifferenceCount == 0) {
+			printf("All %d frames match %s\n", frameCount, goldenFilePath);
+		}
+		else if (firstGoldenDifference >= 0) {
+			printf("%d of %d frames differ from %s (starting at frame %d)\n", goldenDifferenceCount, frameCount, goldenFilePath, firstGoldenDifference);
+		}
 	}
+
+	return shouldContinue && goldenDifferenceCount == 0;
 }
 
-void renderVideoTexture() {
-	int backgroundColorIndex = 16;
-	Color bgColor = systemPalette[backgroundColorIndex];
+/* # BENCHMARK */
 
-	// will changing these a bunch cause a perf issue?
-	SDL_SetRenderTarget(renderer, textures[BITSY_VIDEO]);
+// `--bench` runs the scenarios in bench/bench.js (plus booting the engine) headlessly, and reports
+// the time, native calls and javascript heap allocations per frame for each one
+#define BENCH_BOOT_COUNT 20
+#define BENCH_NAME_MAX 64
 
-	// fill background
-	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
-	SDL_Rect videoFillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
-	SDL_RenderFillRect(renderer, &videoFillRect);
+int isBenchmarking = 0;
 
-	// draw pixels
-	if (!isMemoryBlockEmpty(BITSY_VIDEO)) {
-		MemoryBlock videoMemory = memory[BITSY_VIDEO];
-		for (int i = 0; i < videoMemory.size; i++) {
-			int pixelColorIndex = videoMemory.data[i];
+// an engine with the bench game and scenarios loaded, and allocations counted
+duk_context* createBenchHeap() {
+	duk_context* ctx = createCountingHeap();
 
-			// skip background color since that's the fill color
-			if (pixelColorIndex >= 0 && pixelColorIndex != backgroundColorIndex) {
-				int pixelX = i % BITSY_VIDEO_SIZE;
-				int pixelY = i / BITSY_VIDEO_SIZE;
+	initSystem(ctx);
 
-				Color pixelColor = systemPalette[pixelColorIndex];
-				SDL_Rect pixelRect = { (pixelX * renderScale), (pixelY * renderScale), renderScale, renderScale, };
-				SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0x00);
-				SDL_RenderFillRect(renderer, &pixelRect);
-			}
-		}		
+#ifdef BUILD_DEBUG
+	shouldContinue = shouldContinue && loadScript(ctx, "bench/bench.js");
+	shouldContinue = shouldContinue && loadFile(ctx, "bench/bench.bitsy", "__bitsybox_game_data__");
+#else
+	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, bench_js);
+	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, bench_bitsy, "__bitsybox_game_data__");
+#endif
+
+	return ctx;
+}
+
+// calls `name(scenarioIndex, frameIndex)` in bench.js, leaving its result on the stack if it succeeds
+int callBenchFunction(duk_context* ctx, const char* name, int scenarioIndex, int frameIndex) {
+	duk_get_global_string(ctx, name);
+	duk_push_int(ctx, scenarioIndex);
+	duk_push_int(ctx, frameIndex);
+
+	if (duk_pcall(ctx, 2) != 0) {
+		printf("Bench Error: %s\n", duk_safe_to_string(ctx, -1));
+		duk_pop(ctx);
+		shouldContinue = 0;
+		return 0;
 	}
+
+	return 1;
 }
 
-void renderTileTextures() {
-	int backgroundColorIndex = 16;
-	Color bgColor = systemPalette[backgroundColorIndex];
+// holds the buttons named in `names` (separated by spaces)
+void setBenchButtons(const char* names) {
+	char nameBuffer[256];
+	snprintf(nameBuffer, sizeof(nameBuffer), "%s", names);
 
-	// render tiles
-	for (int tileIndex = BITSY_TILE_START; tileIndex < MEMORY_BLOCK_MAX; tileIndex++) {
-		if (textures[tileIndex] != NULL) {
-			SDL_SetRenderTarget(renderer, textures[tileIndex]);
+	uint32_t buttons = 0;
+	for (char* token = strtok(nameBuffer, " "); token != NULL; token = strtok(NULL, " ")) {
+		buttons |= inputScriptButtonBit(token);
+	}
 
-			SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0xFF);
-			SDL_Rect tileFillRect = { 0, 0, (BITSY_TILE_SIZE * renderScale), (BITSY_TILE_SIZE * renderScale), };
-			SDL_RenderFillRect(renderer, &tileFillRect);
+	setButtonStates(buttons);
+}
 
-			if (!isMemoryBlockEmpty(tileIndex)) {
-				MemoryBlock tileMemory = memory[tileIndex];
-				for (int pixelIndex = 0; pixelIndex < tileMemory.size; pixelIndex++) {
-					int pixelColorIndex = tileMemory.data[pixelIndex];
+void printBenchResult(const char* name, int frameCount, Uint64 time, uint64_t callCount, uint64_t allocCount) {
+	printf(
+		"%-24s %6d %12.0f %12.1f %12.1f\n",
+		name,
+		frameCount,
+		ticksToMs(time) * 1000000.0 / frameCount,
+		(double) callCount / frameCount,
+		(double) allocCount / frameCount);
+}
 
-					// skip background color since that's the fill color
-					if (pixelColorIndex >= 0 && pixelColorIndex != backgroundColorIndex) {
-						Color pixelColor = systemPalette[pixelColorIndex];
+void benchBoot() {
+	Uint64 time = 0;
+	uint64_t callCount = 0;
+	uint64_t allocCount = 0;
 
-						// convert index to 2d coords
-						int pixelX = pixelIndex % BITSY_TILE_SIZE;
-						int pixelY = pixelIndex / BITSY_TILE_SIZE;
+	for (int i = 0; i < BENCH_BOOT_COUNT && shouldContinue; i++) {
+		resetNativeCallCounts();
+		Uint64 startTime = SDL_GetPerformanceCounter();
 
-						SDL_Rect pixelRect = { (pixelX * renderScale), (pixelY * renderScale), renderScale, renderScale, };
-						SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0xFF);
-						SDL_RenderFillRect(renderer, &pixelRect);
-					}
-				}
-			}
-		}
+		// from a new heap to the first composed frame (the game's title)
+		duk_context* ctx = createBenchHeap();
+		duk_push_number(ctx, FRAME_STEP_MS);
+		duk_put_global_string(ctx, "__bitsybox_delta_time__");
+		runEngineUpdates(ctx, 1);
+		captureFrame(&frameSnapshots[0], 0);
+		composeFramebuffer(&frameSnapshots[0]);
+
+		time += SDL_GetPerformanceCounter() - startTime;
+		callCount += nativeCallTotal();
+		allocCount += getHeapStats(ctx)->allocCount;
+
+		destroyCountingHeap(ctx);
 	}
 
-	// render tilemap 1
-	SDL_SetRenderTarget(renderer, textures[BITSY_MAP1]);
+	printBenchResult("boot to first frame", BENCH_BOOT_COUNT, time, callCount, allocCount);
+}
 
-	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
-	SDL_Rect map1FillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
-	SDL_RenderFillRect(renderer, &map1FillRect);
+int runBench() {
+	isNativeCallCounting = 1;
+	isBitsyLogQuiet = 1;
+	isWorldCacheEnabled = 0;
 
-	if (!isMemoryBlockEmpty(BITSY_MAP1)) {
-		MemoryBlock map1Memory = memory[BITSY_MAP1];
-		for (int i = 0; i < map1Memory.size; i++) {
-			int tileId = map1Memory.data[i];
+	printf("%-24s %6s %12s %12s %12s\n", "scenario", "frames", "ns/frame", "calls/frame", "allocs/frame");
 
-			// convert index to 2d *tile* coords
-			int tileX = i % BITSY_MAP_SIZE;
-			int tileY = i / BITSY_MAP_SIZE;
+	benchBoot();
 
-			SDL_Rect tileRect = {
-				(tileX * BITSY_TILE_SIZE * renderScale),
-				(tileY * BITSY_TILE_SIZE * renderScale),
-				(BITSY_TILE_SIZE * renderScale),
-				(BITSY_TILE_SIZE * renderScale),
-			};
+	int scenarioCount = 1;
 
-			if (tileId >= BITSY_TILE_START && tileId < TEXTURE_MAX && textures[tileId] != NULL) {
-				SDL_RenderCopy(renderer, textures[tileId], NULL, &tileRect);
-			}
-		}
-	}
+	for (int i = 0; i < scenarioCount && shouldContinue; i++) {
+		duk_context* ctx = createBenchHeap();
 
-	// render tilemap 2
-	SDL_SetRenderTarget(renderer, textures[BITSY_MAP2]);
+		duk_peval_string(ctx, "__bitsybox_bench_scenarios__");
+		scenarioCount = (int) duk_get_length(ctx, -1);
+		duk_get_prop_index(ctx, -1, i);
 
-	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
-	SDL_Rect map2FillRect = { 0, 0, (BITSY_VIDEO_SIZE * renderScale), (BITSY_VIDEO_SIZE * renderScale), };
-	SDL_RenderFillRect(renderer, &map2FillRect);
+		duk_get_prop_string(ctx, -1, "name");
+		char name[BENCH_NAME_MAX];
+		snprintf(name, sizeof(name), "%s", duk_safe_to_string(ctx, -1));
+		duk_pop(ctx);
 
-	if (!isMemoryBlockEmpty(BITSY_MAP2)) {
-		MemoryBlock map2Memory = memory[BITSY_MAP2];
-		for (int i = 0; i < map2Memory.size; i++) {
-			int tileId = map2Memory.data[i];
+		duk_get_prop_string(ctx, -1, "frameCount");
+		int frameCount = duk_get_int(ctx, -1);
+		duk_pop(ctx);
 
-			// convert index to 2d *tile* coords
-			int tileX = i % BITSY_MAP_SIZE;
-			int tileY = i / BITSY_MAP_SIZE;
+		duk_get_prop_string(ctx, -1, "isEngineUpdated");
+		int isEngineUpdated = duk_get_boolean(ctx, -1);
+		duk_pop_3(ctx);
 
-			SDL_Rect tileRect = {
-				(tileX * BITSY_TILE_SIZE * renderScale),
-				(tileY * BITSY_TILE_SIZE * renderScale),
-				(BITSY_TILE_SIZE * renderScale),
-				(BITSY_TILE_SIZE * renderScale),
-			};
+		setButtonStates(0);
+		duk_push_number(ctx, FRAME_STEP_MS);
+		duk_put_global_string(ctx, "__bitsybox_delta_time__");
 
-			if (tileId >= BITSY_TILE_START && tileId < TEXTURE_MAX && textures[tileId] != NULL) {
-				SDL_RenderCopy(renderer, textures[tileId], NULL, &tileRect);
+		if (callBenchFunction(ctx, "__bitsybox_bench_setup__", i, 0)) {
+			duk_pop(ctx);
+		}
+
+		resetNativeCallCounts();
+		uint64_t startAllocCount = getHeapStats(ctx)->allocCount;
+		Uint64 startTime = SDL_GetPerformanceCounter();
+
+		for (int frame = 0; frame < frameCount && shouldContinue; frame++) {
+			if (callBenchFunction(ctx, "__bitsybox_bench_frame__", i, frame)) {
+				setBenchButtons(duk_get_string(ctx, -1));
+				duk_pop(ctx);
 			}
+
+			if (isEngineUpdated) {
+				runEngineUpdates(ctx, 1);
+			}
+
+			captureFrame(&frameSnapshots[0], 0);
+			composeFramebuffer(&frameSnapshots[0]);
+			generateFrameAudio(1);
+		}
+
+		Uint64 time = SDL_GetPerformanceCounter() - startTime;
+
+		if (shouldContinue) {
+			printBenchResult(name, frameCount, time, nativeCallTotal(), getHeapStats(ctx)->allocCount - startAllocCount);
 		}
+
+		destroyCountingHeap(ctx);
 	}
 
-	// render textbox
-	SDL_SetRenderTarget(renderer, textures[BITSY_TEXTBOX]);
+	return shouldContinue;
+}
 
-	Color textboxBgColor = systemPalette[0];
-	SDL_SetRenderDrawColor(renderer, textboxBgColor.r, textboxBgColor.g, textboxBgColor.b, 0x00);
-	SDL_Rect textboxFillRect = { 0, 0, (textboxWidth * textboxRenderScale), (textboxHeight * textboxRenderScale), };
-	SDL_RenderFillRect(renderer, &textboxFillRect);
+/* # VALIDATION */
+
+// `--validate=DIR` checks every .bitsy file in a directory on a pool of worker threads (each with
+// its own VM and system state): a game passes if its world parses, its first room renders and it
+// runs `--frames` frames of input without a script error. the input comes from `--input-script`,
+// or else the avatar wanders around pressing ok now and then, and the results go to `--report`
+#define VALIDATION_ERROR_MAX 1024
+#define VALIDATION_THREAD_MAX 64
+
+char validateDirPath[PATH_MAX] = "";
+char validationReportPath[PATH_MAX] = "validation.json";
+int validationThreadCount = 0; // 0 means one per CPU
+
+typedef struct ValidationResult {
+	char path[PATH_MAX];
+	const char* failedStage; // NULL if the game passed
+	char error[VALIDATION_ERROR_MAX];
+	int frameCount;
+	double loadMs;
+	double parseMs;
+	double firstFrameMs;
+	double framesMs;
+	uint64_t firstFrameHash;
+} ValidationResult;
+
+ValidationResult* validationResults = NULL;
+int validationGameCount = 0;
+SDL_atomic_t nextValidationGame;
+
+// the default input: one second walking in each direction in turn, starting with a press of ok
+uint32_t wanderingButtons(int frame) {
+	static const int directions[] = { BITSY_BTN_RIGHT, BITSY_BTN_DOWN, BITSY_BTN_LEFT, BITSY_BTN_UP };
+
+	if ((frame % FRAME_RATE) < 10) {
+		return 1u << BITSY_BTN_OK;
+	}
 
-	if (!isMemoryBlockEmpty(BITSY_TEXTBOX)) {
-		MemoryBlock textboxMemory = memory[BITSY_TEXTBOX];
-		for (int i = 0; i < textboxMemory.size; i++) {
-			int pixelColorIndex = textboxMemory.data[i];
+	return 1u << directions[(frame / FRAME_RATE) % 4];
+}
 
-			// since the texture is filled with color 0, we can skip pixels with that color
-			if (pixelColorIndex > 0) {
-				Color pixelColor = systemPalette[pixelColorIndex];
+// runs `code`, and if it throws, fails the game at `stage` with its error
+int runValidationStep(duk_context* ctx, ValidationResult* result, const char* stage, const char* code) {
+	int success = 1;
 
-				// convert index to 2d coords
-				int pixelX = i % textboxWidth;
-				int pixelY = i / textboxWidth;
+	if (duk_peval_string(ctx, code) != 0) {
+		result->failedStage = stage;
 
-				SDL_Rect pixelRect = { (pixelX * textboxRenderScale), (pixelY * textboxRenderScale), textboxRenderScale, textboxRenderScale, };
-				SDL_SetRenderDrawColor(renderer, pixelColor.r, pixelColor.g, pixelColor.b, 0x00);
-				SDL_RenderFillRect(renderer, &pixelRect);
-			}
+		// the stack trace says where the error came from, when there is one
+		if (duk_is_error(ctx, -1)) {
+			duk_get_prop_string(ctx, -1, "stack");
+			duk_replace(ctx, -2);
 		}
+
+		snprintf(result->error, sizeof(result->error), "%s", duk_safe_to_string(ctx, -1));
+		success = 0;
 	}
+
+	duk_pop(ctx);
+
+	return success;
 }
 
-void renderFrame() {
-	int backgroundColorIndex = 16;
-	Color bgColor = systemPalette[backgroundColorIndex];
+void validateGame(ValidationResult* result, FrameSnapshot* frame) {
+	// a fresh system state for every game
+	resetSystemState();
+	curSystem->isAudioMuted = 1;
+	curSystem->isInputScripted = 1;
 
-	int screenSize = (windowWidth <= windowHeight) ? windowWidth : windowHeight;
+	duk_context* ctx = createCountingHeap();
 
-	SDL_Rect screenRect = (SDL_Rect) {
-		(windowWidth / 2) - (screenSize / 2),
-		(windowHeight / 2) - (screenSize / 2),
-		screenSize,
-		screenSize,
-	};
+	Uint64 startTime = SDL_GetPerformanceCounter();
 
-	// update textures
-	if (shouldRenderTextures) {
-		if (curGraphicsMode == BITSY_GFX_VIDEO) {
-			renderVideoTexture();
+	resetMemory();
+	initBitsyInterface(ctx);
+
+	if (!loadEngine(ctx)) {
+		result->failedStage = "engine";
+		snprintf(result->error, sizeof(result->error), "Error loading the engine");
+	}
+	else if (!loadFile(ctx, result->path, "__bitsybox_game_data__")) {
+		result->failedStage = "load";
+		snprintf(result->error, sizeof(result->error), "Error reading the game file");
+	}
+
+	Uint64 time = SDL_GetPerformanceCounter();
+	result->loadMs = ticksToMs(time - startTime);
+
+	if (result->failedStage == NULL) {
+		runValidationStep(ctx, result, "parse", "parseWorld(bitsy.getGameData());");
+
+		Uint64 parseEndTime = SDL_GetPerformanceCounter();
+		result->parseMs = ticksToMs(parseEndTime - time);
+		time = parseEndTime;
+	}
+
+	duk_push_number(ctx, FRAME_STEP_MS);
+	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+
+	// the first frame of the game after its title
+	if (result->failedStage == NULL &&
+		runValidationStep(ctx, result, "first frame", "load_game(bitsy.getGameData(), bitsy.getFontData(), false);") &&
+		runValidationStep(ctx, result, "first frame", "__bitsybox_on_update__(__bitsybox_delta_time__);") &&
+		runValidationStep(ctx, result, "first frame", "if (state.room == null || !room[state.room]) { throw new Error('The game has no room to start in'); }")) {
+		captureFrame(frame, 0);
+		composeFramebuffer(frame);
+
+		FrameHashes hashes;
+		hashFramebuffer(&hashes);
+		result->firstFrameHash = hashes.frame;
+	}
+
+	Uint64 firstFrameEndTime = SDL_GetPerformanceCounter();
+	result->firstFrameMs = ticksToMs(firstFrameEndTime - time);
+	time = firstFrameEndTime;
+
+	int nextStep = 0;
+
+	while (result->failedStage == NULL && result->frameCount < headlessFrameCount) {
+		if (inputScriptStepCount <= 0) {
+			curSystem->scriptedButtons = wanderingButtons(result->frameCount);
 		}
-		else {
-			renderTileTextures();
+
+		while (nextStep < inputScriptStepCount && inputScriptSteps[nextStep].frame <= result->frameCount) {
+			curSystem->scriptedButtons = inputScriptBitsyButtons(inputScriptSteps[nextStep].buttons);
+			nextStep++;
+		}
+
+		if (!runValidationStep(ctx, result, "frames", "__bitsybox_on_update__(__bitsybox_delta_time__);")) {
+			break;
 		}
 
-		shouldRenderTextures = 0;
+		captureFrame(frame, 0);
+		composeFramebuffer(frame);
+
+		result->frameCount++;
 	}
 
-	// render screen
-	SDL_SetRenderTarget(renderer, NULL);
+	result->framesMs = ticksToMs(SDL_GetPerformanceCounter() - time);
 
-	// fill the screen with the background color
-	SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, 0x00);
-	SDL_Rect windowRect = { 0, 0, windowWidth, windowHeight };
-	SDL_RenderFillRect(renderer, &windowRect);
+	destroyCountingHeap(ctx);
+	initializeMemoryBlocks();
 
-	if (curGraphicsMode == BITSY_GFX_VIDEO) {
-		// copy the screen buffer texture into the renderer
-		SDL_RenderCopy(renderer, textures[BITSY_VIDEO], NULL, &screenRect);
+	if (result->failedStage == NULL) {
+		printf("ok   %s\n", result->path);
 	}
 	else {
-		// draw tile map layers
-		SDL_RenderCopy(renderer, textures[BITSY_MAP1], NULL, &screenRect);
-		SDL_RenderCopy(renderer, textures[BITSY_MAP2], NULL, &screenRect);
+		printf("FAIL %s (%s)\n", result->path, result->failedStage);
+	}
+}
 
-		// draw textbox
-		if (isTextboxVisible) {
-			// calculate textbox dimensions in terms of the current window size
-			float bitsyToScreenRatio = ((float) screenSize) / ((float) BITSY_VIDEO_SIZE);
-			float textboxRatio = ((float) textboxRenderScale) / ((float) renderScale);
-			SDL_Rect textboxRect = {
-				screenRect.x + (textboxX * bitsyToScreenRatio),
-				screenRect.y + (textboxY * bitsyToScreenRatio),
-				(textboxWidth * textboxRatio * bitsyToScreenRatio),
-				(textboxHeight * textboxRatio * bitsyToScreenRatio),
-			};
+int validationWorkerMain(void* data) {
+	SystemState* system = calloc(1, sizeof(SystemState));
+	FrameSnapshot* frame = calloc(1, sizeof(FrameSnapshot));
 
-			SDL_RenderCopy(renderer, textures[BITSY_TEXTBOX], NULL, &textboxRect);
-		}
+	// (this is bitsybox's own state if there are no worker threads)
+	SystemState* prevSystem = curSystem;
+	curSystem = system;
+
+	int gameIndex;
+	while ((gameIndex = SDL_AtomicAdd(&nextValidationGame, 1)) < validationGameCount) {
+		validateGame(&validationResults[gameIndex], frame);
 	}
 
-	// show the frame
-	SDL_RenderPresent(renderer);
+	curSystem = prevSystem;
+
+	free(frame);
+	free(system);
+
+	return 0;
 }
 
-void updateSystem(duk_context* ctx, int deltaTime) {
-	// get latest input
-	updateInput();
+int compareValidationResults(const void* a, const void* b) {
+	return strcmp(((const ValidationResult*) a)->path, ((const ValidationResult*) b)->path);
+}
 
-	// send the frame's delta time to the javascript VM
-	duk_push_int(ctx, deltaTime);
-	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+// finds the .bitsy files in the validation directory (sorted, so reports are easy to compare)
+int findValidationGames() {
+	DIR* dir = opendir(validateDirPath);
 
-	// execute engine main loop
-	if (duk_peval_string(ctx, "__bitsybox_on_update__(__bitsybox_delta_time__);") != 0) {
-		printf("Update Bitsy Error: %s\n", duk_safe_to_string(ctx, -1));
+	if (dir == NULL) {
+		printf("Error reading %s\n", validateDirPath);
+		return 0;
 	}
-	duk_pop(ctx);
 
-	// draw frame
-	renderFrame();
+	struct dirent* file;
+	int resultCapacity = 0;
 
-	if (didWindowResizeThisFrame) {
-		onWindowResize();
+	while ((file = readdir(dir)) != NULL) {
+		const char* extension = strrchr(file->d_name, '.');
+
+		if (extension == NULL || strcmp(extension, ".bitsy") != 0) {
+			continue;
+		}
+
+		char path[PATH_MAX];
+		int pathLength = snprintf(path, sizeof(path), "%s/%s", validateDirPath, file->d_name);
+
+		if (pathLength < 0 || pathLength >= (int) sizeof(path)) {
+			printf("Skipping %s (the path is too long)\n", file->d_name);
+			continue;
+		}
+
+		if (validationGameCount >= resultCapacity) {
+			resultCapacity = resultCapacity > 0 ? resultCapacity * 2 : 64;
+			validationResults = realloc(validationResults, resultCapacity * sizeof(ValidationResult));
+		}
+
+		ValidationResult* result = &validationResults[validationGameCount++];
+		memset(result, 0, sizeof(ValidationResult));
+		memcpy(result->path, path, pathLength + 1);
+	}
+
+	closedir(dir);
+
+	if (validationGameCount > 0) {
+		qsort(validationResults, validationGameCount, sizeof(ValidationResult), compareValidationResults);
 	}
 
-	didWindowResizeThisFrame = 0;
+	return 1;
 }
 
-/* # BITSYBOX MODES */
+int writeValidationReport(int threadCount, double totalMs, int failedCount) {
+	FILE* f = fopen(validationReportPath, "w");
 
-int shouldStartTuneDemo = 0;
+	if (f == NULL) {
+		printf("Error writing %s\n", validationReportPath);
+		return 0;
+	}
 
-void bootMenu() {
-	SDL_SetWindowTitle(window, "BITSYBOX");
+	fprintf(f, "{\n\t\"directory\": ");
+	writeJsonString(f, validateDirPath);
+	fprintf(f, ",\n\t\"threads\": %d,\n", threadCount);
+	fprintf(f, "\t\"frames\": %d,\n", headlessFrameCount);
+	fprintf(f, "\t\"seed\": %" PRIu32 ",\n", randomSeed);
+	fprintf(f, "\t\"totalMs\": %.3f,\n", totalMs);
+	fprintf(f, "\t\"passed\": %d,\n", validationGameCount - failedCount);
+	fprintf(f, "\t\"failed\": %d,\n", failedCount);
+	fprintf(f, "\t\"games\": [");
+
+	for (int i = 0; i < validationGameCount; i++) {
+		ValidationResult* result = &validationResults[i];
+
+		fprintf(f, "%s\n\t\t{\n\t\t\t\"file\": ", i > 0 ? "," : "");
+		writeJsonString(f, result->path);
+		fprintf(f, ",\n\t\t\t\"passed\": %s,\n", result->failedStage == NULL ? "true" : "false");
+
+		if (result->failedStage != NULL) {
+			fprintf(f, "\t\t\t\"failedStage\": ");
+			writeJsonString(f, result->failedStage);
+			fprintf(f, ",\n\t\t\t\"error\": ");
+			writeJsonString(f, result->error);
+			fprintf(f, ",\n");
+		}
 
-	duk_context* ctx = duk_create_heap_default();
+		fprintf(f, "\t\t\t\"frames\": %d,\n", result->frameCount);
+		fprintf(f, "\t\t\t\"firstFrameHash\": \"%016" PRIx64 "\",\n", result->firstFrameHash);
+		fprintf(f, "\t\t\t\"loadMs\": %.3f,\n", result->loadMs);
+		fprintf(f, "\t\t\t\"parseMs\": %.3f,\n", result->parseMs);
+		fprintf(f, "\t\t\t\"firstFrameMs\": %.3f,\n", result->firstFrameMs);
+		fprintf(f, "\t\t\t\"framesMs\": %.3f\n", result->framesMs);
+		fprintf(f, "\t\t}");
+	}
 
-	// load game files
-	duk_peval_string(ctx, "__bitsybox_game_files__ = []");
-	duk_pop(ctx);
-	struct dirent* files;
-	DIR* dir = opendir("./games");
+	fprintf(f, "\n\t]\n}\n");
+	fclose(f);
 
-	if (dir != NULL ) {
-		while ((files = readdir(dir)) != NULL) {
-			duk_push_string(ctx, files->d_name);
-			duk_put_global_string(ctx, "__bitsybox_filename__");
-			duk_peval_string(
-				ctx,
-				"var fileSplit = __bitsybox_filename__.split('.');"
-				"if (fileSplit[fileSplit.length - 1] === 'bitsy') { __bitsybox_game_files__.push(__bitsybox_filename__); }");
-			duk_pop(ctx);
-		}
+	return 1;
+}
 
-		closedir(dir);
+int runValidation() {
+	// the games run side by side, so they don't log or share the world cache
+	isBitsyLogQuiet = 1;
+	isWorldCacheEnabled = 0;
+
+	if (inputScriptPath[0] != '\0' && !loadInputScript()) {
+		return 0;
 	}
 
-	// loop time
-	int prevTime = SDL_GetTicks();
-	int deltaTime = 0;
+	if (!findValidationGames()) {
+		return 0;
+	}
 
-	int isBootFinished = 0;
+	int threadCount = validationThreadCount > 0 ? validationThreadCount : SDL_GetCPUCount();
+	threadCount = threadCount < VALIDATION_THREAD_MAX ? threadCount : VALIDATION_THREAD_MAX;
+	threadCount = threadCount < validationGameCount ? threadCount : validationGameCount;
 
-	initSystem(ctx);
+	printf("Validating %d games in %s on %d threads\n", validationGameCount, validateDirPath, threadCount);
 
-	// load boot menu
-#ifdef BUILD_DEBUG
-	shouldContinue = shouldContinue && loadScript(ctx, "boot/boot.js");
-	shouldContinue = shouldContinue && loadFile(ctx, "boot/boot.bitsy", "__bitsybox_game_data__");
-#else
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, boot_js);
-	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, boot_bitsy, "__bitsybox_game_data__");
-#endif
+	Uint64 startTime = SDL_GetPerformanceCounter();
 
-	while (shouldContinue && !isBootFinished) {
-		// update time
-		deltaTime = SDL_GetTicks() - prevTime;
-		prevTime = SDL_GetTicks();
+	SDL_AtomicSet(&nextValidationGame, 0);
+	SDL_Thread* threads[VALIDATION_THREAD_MAX];
+	int startedThreadCount = 0;
 
-		updateSystem(ctx, deltaTime);
+	for (int i = 0; i < threadCount; i++) {
+		threads[startedThreadCount] = SDL_CreateThread(validationWorkerMain, "bitsybox validate", NULL);
 
-		duk_peval_string(ctx, "__bitsybox_is_boot_finished__");
-		isBootFinished = duk_get_boolean(ctx, -1);
-		duk_pop(ctx);
+		if (threads[startedThreadCount] == NULL) {
+			printf("Couldn't start a validation thread: %s\n", SDL_GetError());
+		}
+		else {
+			startedThreadCount++;
+		}
 	}
 
-	if (isBootFinished) {
-		duk_peval_string(ctx, "__bitsybox_selected_game_name__");
-		SDL_SetWindowTitle(window, duk_get_string(ctx, -1));
-		duk_pop(ctx);
+	if (startedThreadCount == 0) {
+		// validate them all on this thread instead
+		validationWorkerMain(NULL);
+	}
 
-		duk_peval_string(ctx, "__bitsybox_selected_game__");
-		sprintf(gameFilePath, "./games/%s", duk_get_string(ctx, -1));
-		duk_pop(ctx);
+	for (int i = 0; i < startedThreadCount; i++) {
+		SDL_WaitThread(threads[i], NULL);
+	}
 
-		duk_peval_string(ctx, "__bitsybox_game_files__.length");
-		gameCount = duk_get_int(ctx, -1);
-		duk_pop(ctx);
+	double totalMs = ticksToMs(SDL_GetPerformanceCounter() - startTime);
 
-		duk_peval_string(ctx, "__bitsybox_should_start_tune_demo__");
-		shouldStartTuneDemo = duk_get_boolean(ctx, -1);
-		duk_pop(ctx);
+	int failedCount = 0;
+	for (int i = 0; i < validationGameCount; i++) {
+		if (validationResults[i].failedStage != NULL) {
+			failedCount++;
+		}
 	}
 
-	duk_destroy_heap(ctx);
-}
-
-void gameLoop() {
-	duk_context* ctx = duk_create_heap(NULL, NULL, NULL, NULL, fatalError);
+	int isReportWritten = writeValidationReport(startedThreadCount > 0 ? startedThreadCount : 1, totalMs, failedCount);
 
-	// loop time
-	int prevTime = SDL_GetTicks();
-	int deltaTime = 0;
+	printf(
+		"%d of %d games passed in %.3f seconds (report in %s)\n",
+		validationGameCount - failedCount,
+		validationGameCount,
+		totalMs / 1000.0,
+		validationReportPath);
 
-	int isGameOver = 0;
+	free(validationResults);
 
-	initSystem(ctx);
+	return isReportWritten && failedCount == 0;
+}
 
-	shouldContinue = shouldContinue && loadFile(ctx, gameFilePath, "__bitsybox_game_data__");
+/* # COMMAND LINE */
 
-	duk_peval_string(ctx, "var __bitsybox_is_game_over__ = false;");
-	duk_pop(ctx);
+// returns the value of a "--name=value" argument, or NULL if `arg` isn't that option
+const char* commandLineValue(const char* arg, const char* name) {
+	size_t nameLength = strlen(name);
 
-	if (gameCount > 1) {
-		// hack to return to main menu on game end if there's more than one
-		duk_peval_string(ctx, "reset_cur_game = function() { __bitsybox_is_game_over__ = true; };");
-		duk_pop(ctx);
+	if (strncmp(arg, name, nameLength) == 0 && arg[nameLength] == '=') {
+		return &arg[nameLength + 1];
 	}
 
-	while (shouldContinue && !isGameOver) {
-		// keep track of time
-		deltaTime = SDL_GetTicks() - prevTime;
-		prevTime = SDL_GetTicks();
+	return NULL;
+}
 
-		updateSystem(ctx, deltaTime);
+void parseCommandLine(int argc, char* argv[]) {
+	for (int i = 1; i < argc; i++) {
+		const char* value = NULL;
 
-		// kind of hacky way to trigger restart
-		if (duk_peval_string(ctx, "if (bitsy.button(bitsy.BTN_MENU)) { reset_cur_game(); }") != 0) {
-			printf("Test Restart Game Error: %s\n", duk_safe_to_string(ctx, -1));
+		if ((value = commandLineValue(argv[i], "--audio-latency")) != NULL) {
+			if (strcmp(value, "low") == 0) {
+				audioLatencyMode = AUDIO_LATENCY_LOW;
+			}
+			else if (strcmp(value, "default") == 0) {
+				audioLatencyMode = AUDIO_LATENCY_DEFAULT;
+			}
+			else if (strcmp(value, "powersave") == 0) {
+				audioLatencyMode = AUDIO_LATENCY_POWERSAVE;
+			}
+			else {
+				printf("Unknown audio latency mode: %s\n", value);
+			}
 		}
-		duk_pop(ctx);
-
-		if (duk_peval_string(ctx, "__bitsybox_is_game_over__") != 0) {
-			printf("Test Game Over Error: %s\n", duk_safe_to_string(ctx, -1));
+		else if ((value = commandLineValue(argv[i], "--record")) != NULL) {
+			snprintf(inputRecordPath, sizeof(inputRecordPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--replay")) != NULL) {
+			snprintf(inputReplayPath, sizeof(inputReplayPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--seed")) != NULL) {
+			randomSeed = (uint32_t) strtoul(value, NULL, 10);
+			isRandomSeedSet = 1;
+		}
+		else if ((value = commandLineValue(argv[i], "--profile-file")) != NULL) {
+			snprintf(profileFilePath, sizeof(profileFilePath), "%s", value);
+		}
+		else if (strcmp(argv[i], "--input-latency") == 0) {
+			isInputLatencyEnabled = 1;
+		}
+		else if (strcmp(argv[i], "--update-thread") == 0) {
+			isUpdateThreadEnabled = 1;
+		}
+		else if (strcmp(argv[i], "--vsync") == 0) {
+			isVsyncEnabled = 1;
+		}
+		else if ((value = commandLineValue(argv[i], "--audio-stats")) != NULL) {
+			audioStatsDumpSeconds = atof(value);
+		}
+		else if ((value = commandLineValue(argv[i], "--audio-stats-file")) != NULL) {
+			snprintf(audioStatsFilePath, sizeof(audioStatsFilePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--memory-stats")) != NULL) {
+			memoryStatsDumpSeconds = atof(value);
+		}
+		else if ((value = commandLineValue(argv[i], "--memory-stats-file")) != NULL) {
+			snprintf(memoryStatsFilePath, sizeof(memoryStatsFilePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--trace")) != NULL) {
+			snprintf(tracePath, sizeof(tracePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--headless")) != NULL) {
+			snprintf(headlessGamePath, sizeof(headlessGamePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--frames")) != NULL) {
+			headlessFrameCount = atoi(value);
+		}
+		else if ((value = commandLineValue(argv[i], "--hash-file")) != NULL) {
+			snprintf(hashFilePath, sizeof(hashFilePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--golden")) != NULL) {
+			snprintf(goldenFilePath, sizeof(goldenFilePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--input-script")) != NULL) {
+			snprintf(inputScriptPath, sizeof(inputScriptPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--validate")) != NULL) {
+			snprintf(validateDirPath, sizeof(validateDirPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--threads")) != NULL) {
+			validationThreadCount = atoi(value);
+		}
+		else if ((value = commandLineValue(argv[i], "--report")) != NULL) {
+			snprintf(validationReportPath, sizeof(validationReportPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--log-level")) != NULL) {
+			for (int level = 0; level < LOG_LEVEL_COUNT; level++) {
+				if (strcmp(value, logLevelNames[level]) == 0) {
+					logLevel = level;
+				}
+			}
+		}
+		else if ((value = commandLineValue(argv[i], "--log-categories")) != NULL) {
+			snprintf(logCategories, sizeof(logCategories), "%s", value);
+		}
+		else if (strcmp(argv[i], "--log-thread") == 0) {
+			isLogThreadEnabled = 1;
+		}
+		else if (strcmp(argv[i], "--call-stats") == 0) {
+			isCallStatsEnabled = 1;
+		}
+		else if (strcmp(argv[i], "--call-stats-callers") == 0) {
+			isCallStatsEnabled = 1;
+			isCallerStatsEnabled = 1;
+		}
+		else if ((value = commandLineValue(argv[i], "--call-stats-file")) != NULL) {
+			isCallStatsEnabled = 1;
+			snprintf(callStatsFilePath, sizeof(callStatsFilePath), "%s", value);
+		}
+		else if (strcmp(argv[i], "--bench") == 0) {
+			isBenchmarking = 1;
+		}
+		else if ((value = commandLineValue(argv[i], "--render-wav")) != NULL) {
+			snprintf(renderWavPath, sizeof(renderWavPath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--render-game")) != NULL) {
+			snprintf(renderGamePath, sizeof(renderGamePath), "%s", value);
+		}
+		else if ((value = commandLineValue(argv[i], "--render-tune")) != NULL) {
+			snprintf(renderSoundId, sizeof(renderSoundId), "%s", value);
+			isRenderingBlip = 0;
+		}
+		else if ((value = commandLineValue(argv[i], "--render-blip")) != NULL) {
+			snprintf(renderSoundId, sizeof(renderSoundId), "%s", value);
+			isRenderingBlip = 1;
+		}
+		else if ((value = commandLineValue(argv[i], "--render-seconds")) != NULL) {
+			renderSeconds = atof(value);
+		}
+		else {
+			printf("Unknown option: %s\n", argv[i]);
 		}
-		isGameOver = duk_get_boolean(ctx, -1);
-		duk_pop(ctx);
 	}
-
-	duk_destroy_heap(ctx);
 }
 
-void demoLoop() {
-	SDL_SetWindowTitle(window, "DEMO");
+/* # FUZZING */
 
-	duk_context* ctx = duk_create_heap_default();
+// the fuzz targets build with BUILD_FUZZ_WORLD or BUILD_FUZZ_API in place of bitsybox's own `main`,
+// and work with libFuzzer (or AFL++'s libFuzzer driver). with BUILD_FUZZ_STANDALONE they get a
+// `main` that runs each file on the command line (or stdin) once instead, for plain AFL builds
+// and for reproducing crashes
+#ifdef BUILD_FUZZ
 
-	// loop time
-	int prevTime = SDL_GetTicks();
-	int deltaTime = 0;
+// a system state like the one a `--validate` game gets
+void startFuzzInput() {
+	isBitsyLogQuiet = 1;
+	isWorldCacheEnabled = 0;
 
-	int isTestFinished = 0;
+	resetSystemState();
+	curSystem->isAudioMuted = 1;
+	curSystem->isInputScripted = 1;
+}
 
-	initSystem(ctx);
+void composeFuzzFrame() {
+	static FrameSnapshot frame;
+	captureFrame(&frame, 0);
+	composeFramebuffer(&frame);
+}
 
-	// load demo program
+#ifdef BUILD_FUZZ_WORLD
+// the input is game data, which is parsed, loaded and run for a frame on a new heap each time
+// (script errors are expected, so only crashes and sanitizer reports count)
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	startFuzzInput();
+
+	duk_context* ctx = createCountingHeap();
+
+	resetMemory();
+	initBitsyInterface(ctx);
+
+	int isLoaded = loadEngine(ctx);
 #ifdef BUILD_DEBUG
-	shouldContinue = shouldContinue && loadScript(ctx, "test/demo.js");
+	isLoaded = isLoaded && loadScript(ctx, "fuzz/fuzz.js");
 #else
-	// not currently embedding the demo program since it's just for test purposes
-	shouldContinue = 0;
+	isLoaded = isLoaded && loadEmbeddedScript(ctx, fuzz_js);
 #endif
 
-	while (shouldContinue && !isTestFinished) {
-		// update time
-		deltaTime = SDL_GetTicks() - prevTime;
-		prevTime = SDL_GetTicks();
+	if (!isLoaded) {
+		abort();
+	}
+
+	duk_push_lstring(ctx, (const char*) data, size);
+	duk_put_global_string(ctx, "__bitsybox_game_data__");
+	duk_push_number(ctx, FRAME_STEP_MS);
+	duk_put_global_string(ctx, "__bitsybox_delta_time__");
+
+	if (duk_peval_string(ctx, "__bitsybox_fuzz_world__();") == 0) {
+		duk_pop(ctx);
 
-		updateSystem(ctx, deltaTime);
+		duk_peval_string(ctx, "__bitsybox_on_update__(__bitsybox_delta_time__);");
+		composeFuzzFrame();
 	}
 
-	duk_destroy_heap(ctx);
+	duk_pop(ctx);
+	destroyCountingHeap(ctx);
+	initializeMemoryBlocks();
+
+	return 0;
 }
+#endif
 
-void tuneTool() {
-	SDL_SetWindowTitle(window, "TUNE DEMO");
+#ifdef BUILD_FUZZ_API
+// the memory and graphics parts of the system API, called the way a buggy program might
+typedef struct FuzzApiCall {
+	const char* name;
+	int argCount;
+} FuzzApiCall;
+
+FuzzApiCall fuzzApiCalls[] = {
+	{ "set", 3 },
+	{ "fill", 2 },
+	{ "tile", 0 },
+	{ "delete", 1 },
+	{ "textbox", 1 },
+	{ "textbox", 3 },
+	{ "textbox", 5 },
+	{ "color", 4 },
+	{ "graphicsMode", 1 },
+	{ "textMode", 1 },
+};
+
+#define FUZZ_API_CALL_COUNT (int) (sizeof(fuzzApiCalls) / sizeof(FuzzApiCall))
+
+// the input is a list of calls: one byte chooses the function (the high bit also composes a frame
+// after it), followed by two bytes for each argument (as signed 16 bit numbers, so they go well
+// out of range both ways). the heap has only the system API, and lasts for every input
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	static duk_context* ctx = NULL;
+
+	startFuzzInput();
+	resetMemory();
+
+	if (ctx == NULL) {
+		ctx = createCountingHeap();
+		initBitsyInterface(ctx);
+	}
 
-	duk_context* ctx = duk_create_heap_default();
+	size_t offset = 0;
 
-	// loop time
-	int prevTime = SDL_GetTicks();
-	int deltaTime = 0;
+	while (offset < size) {
+		uint8_t op = data[offset++];
+		FuzzApiCall* call = &fuzzApiCalls[(op & 0x7f) % FUZZ_API_CALL_COUNT];
 
-	initSystem(ctx);
+		if (offset + (call->argCount * 2) > size) {
+			break;
+		}
 
-	// load tune tool program
-#ifdef BUILD_DEBUG
-	shouldContinue = shouldContinue && loadScript(ctx, "tune/dialog_demo.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "tune/tool_demo.js");
-	shouldContinue = shouldContinue && loadScript(ctx, "tune/tune.js");
-	shouldContinue = shouldContinue && loadFile(ctx, "tune/tune.bitsy", "__bitsybox_game_data__");
-#else
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, dialog_demo_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, tool_demo_js);
-	shouldContinue = shouldContinue && loadEmbeddedScript(ctx, tune_js);
-	shouldContinue = shouldContinue && loadEmbeddedFile(ctx, tune_bitsy, "__bitsybox_game_data__");
-#endif
+		duk_get_global_string(ctx, "bitsy");
+		duk_get_prop_string(ctx, -1, call->name);
 
-	int shouldQuitToolDemo = 0;
+		for (int i = 0; i < call->argCount; i++) {
+			duk_push_int(ctx, (int16_t) (data[offset] | (data[offset + 1] << 8)));
+			offset += 2;
+		}
 
-	while (shouldContinue && !shouldQuitToolDemo) {
-		// update time
-		deltaTime = SDL_GetTicks() - prevTime;
-		prevTime = SDL_GetTicks();
+		duk_pcall(ctx, call->argCount);
+		duk_pop_2(ctx);
 
-		// update mouse state
-		int isMouseOnScreen = (mouseX >= 0 && mouseX < BITSY_VIDEO_SIZE && mouseY >= 0 && mouseY < BITSY_VIDEO_SIZE);
-		duk_push_boolean(ctx, isLeftMouseDown && isMouseOnScreen);
-		duk_put_global_string(ctx, "__bitsybox_mouse_down__");
+		if ((op & 0x80) != 0) {
+			composeFuzzFrame();
+		}
+	}
 
-		duk_push_int(ctx, mouseX);
-		duk_put_global_string(ctx, "__bitsybox_mouse_x__");
+	composeFuzzFrame();
+	initializeMemoryBlocks();
 
-		duk_push_int(ctx, mouseY);
-		duk_put_global_string(ctx, "__bitsybox_mouse_y__");
+	return 0;
+}
+#endif
 
-		duk_push_boolean(ctx, (isButtonLAlt || isButtonRAlt));
-		duk_put_global_string(ctx, "__bitsybox_mouse_alt__");
+#ifdef BUILD_FUZZ_STANDALONE
+void runFuzzFile(FILE* f) {
+	uint8_t* data = NULL;
+	size_t size = 0;
+	size_t capacity = 0;
 
-		duk_push_boolean(ctx, isMouseOnScreen);
-		duk_put_global_string(ctx, "__bitsybox_mouse_hover__");
+	while (!feof(f) && !ferror(f)) {
+		if (size >= capacity) {
+			capacity = capacity > 0 ? capacity * 2 : 4096;
+			data = realloc(data, capacity);
+		}
 
-		updateSystem(ctx, deltaTime);
+		size += fread(data + size, 1, capacity - size, f);
+	}
 
-		// check if it's time to quit
-		duk_peval_string(ctx, "__bitsybox_should_quit_tool_demo__");
-		shouldQuitToolDemo = duk_get_boolean(ctx, -1);
-		duk_pop(ctx);
+	LLVMFuzzerTestOneInput(data, size);
+	free(data);
+}
+
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		runFuzzFile(stdin);
+		return 0;
 	}
 
-	duk_destroy_heap(ctx);
+	for (int i = 1; i < argc; i++) {
+		FILE* f = fopen(argv[i], "rb");
+
+		if (f == NULL) {
+			printf("Error reading %s\n", argv[i]);
+			return 1;
+		}
+
+		printf("Running %s\n", argv[i]);
+		runFuzzFile(f);
+		fclose(f);
+	}
+
+	return 0;
 }
+#endif
+
+#endif
 
 /* # BITSYBOX MAIN */
 
+#ifndef BUILD_FUZZ
 int main(int argc, char* argv[]) {
 	printf("~*~*~ bitsybox ~*~*~\n");
 	printf("[duktape version 2.6.0]\n");
 
 	// initialize graphics settings
-	curGraphicsMode = BITSY_GFX_VIDEO;
-	curTextMode = BITSY_TXT_HIREZ;
+	curSystem->graphicsMode = BITSY_GFX_VIDEO;
+	curSystem->textMode = BITSY_TXT_HIREZ;
 
 	// initialize all palette colors to black
 	for (int i = 0; i < PALETTE_MAX; i++) {
-		systemPalette[i] = (Color) { 0, 0, 0 };
+		curSystem->palette[i] = (Color) { 0, 0, 0 };
 	}
 
-	// initialize audio settings
-	dutyChannel1 = BITSY_PULSE_1_2;
-	dutyChannel2 = BITSY_PULSE_1_2;
-	audioVolume = 0.5f;
-	soundChannel1 = wave(440.0f, 1.0f / 2.0f); // A4 square wave
-	soundChannel2 = wave(440.0f, 1.0f / 2.0f);
+	parseCommandLine(argc, argv);
+	startLogger();
+
+	// a replay brings its own seed, and renders, headless runs, benchmarks and validation default to a fixed one
+	if (inputReplayPath[0] != '\0' && !startInputReplay()) {
+		return 1;
+	}
+
+	if (!isRandomSeedSet && renderWavPath[0] == '\0' && headlessGamePath[0] == '\0' && !isBenchmarking && validateDirPath[0] == '\0') {
+		randomSeed = (uint32_t) SDL_GetPerformanceCounter();
+	}
+
+	curSystem->randomState = randomSeed;
+
+	if (inputRecordPath[0] != '\0' && !startInputRecording()) {
+		return 1;
+	}
+
+	if (renderWavPath[0] != '\0') {
+		if (renderGamePath[0] == '\0' || renderSoundId[0] == '\0') {
+			printf("--render-wav needs a --render-game and a --render-tune or --render-blip\n");
+			return 1;
+		}
+
+		// no SDL devices are opened in this mode
+		initAudioSettings();
+		int isSuccess = renderWav();
+		stopLogger();
+		return isSuccess ? 0 : 1;
+	}
+
+	if (headlessGamePath[0] != '\0') {
+		// no SDL devices are opened in this mode either
+		initAudioSettings();
+		startTrace();
+		int isSuccess = runHeadless();
+		stopTrace();
+		stopLogger();
+		printCallStats();
+		stopInputRecording();
+		return isSuccess ? 0 : 1;
+	}
+
+	if (isBenchmarking) {
+		initAudioSettings();
+		return runBench() ? 0 : 1;
+	}
+
+	if (validateDirPath[0] != '\0') {
+		// the games' sound is dropped, so the audio isn't even initialized
+		return runValidation() ? 0 : 1;
+	}
 
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER | SDL_INIT_AUDIO) < 0) {
 		printf("SDL initialization error: %s\n", SDL_GetError());
 		return 1;
 	}
 
+	startTrace();
+
 	// initialize audio
 	SDL_AudioSpec audioSpec = {
 		.format = AUDIO_F32,
 		.channels = 2,
 		.freq = AUDIO_SAMPLE_RATE,
-		.samples = AUDIO_BUFFER_SIZE,
+		.samples = audioBufferSizeForLatency(audioLatencyMode),
 		.callback = audioCallback,
 	};
+	SDL_AudioSpec obtainedAudioSpec;
+
+	// SDL converts the format and channels for us, but the sample rate and buffer size are up to the driver
+	audioDevice = SDL_OpenAudioDevice(
+		NULL,
+		0,
+		&audioSpec,
+		&obtainedAudioSpec,
+		SDL_AUDIO_ALLOW_FREQUENCY_CHANGE | SDL_AUDIO_ALLOW_SAMPLES_CHANGE);
 
-	if (SDL_OpenAudio(&audioSpec, NULL) < 0) {
+	if (audioDevice == 0) {
 		printf("SDL audio error: %s\n", SDL_GetError());
 		return 1;
 	}
 
+	audioSampleRate = obtainedAudioSpec.freq;
+	audioBufferSize = obtainedAudioSpec.samples;
+	printf("[audio %d Hz, %d sample buffer]\n", audioSampleRate, audioBufferSize);
+
+	initAudioSettings();
+
 	// start playing audio if initialization succeeded
-	SDL_PauseAudio(0);
+	SDL_PauseAudioDevice(audioDevice, 0);
 
 	// create window
 	window = SDL_CreateWindow(
@@ -1784,11 +6579,19 @@ int main(int argc, char* argv[]) {
 	windowHeight = (BITSY_VIDEO_SIZE * renderScale);
 
 	// create renderer
-	renderer = SDL_CreateRenderer(window, -1, 0);
+	renderer = SDL_CreateRenderer(window, -1, isVsyncEnabled ? SDL_RENDERER_PRESENTVSYNC : 0);
 
 	// set the working directory to the directory containing the executable
 	chdir(SDL_GetBasePath());
 
+	if (isUpdateThreadEnabled) {
+		startUpdateThread();
+	}
+
+	if (isLogThreadEnabled) {
+		startLogThread();
+	}
+
 #if defined(DEMO_MODE)
 	while (shouldContinue) {
 		demoLoop();
@@ -1810,7 +6613,33 @@ int main(int argc, char* argv[]) {
 	}
 #endif
 
+	stopUpdateThread();
+
+	SDL_CloseAudioDevice(audioDevice);
+	stopTrace();
+	stopLogger();
+
+	AudioStats audioStats;
+	readAudioStats(&audioStats, NULL, 0);
+	printAudioStats(&audioStats);
+	printInputLatency();
+	printCallStats();
+	stopInputRecording();
+
+	if (audioStatsFile != NULL) {
+		fclose(audioStatsFile);
+	}
+
+	if (memoryStatsFile != NULL) {
+		fclose(memoryStatsFile);
+	}
+
+	if (callStatsFile != NULL) {
+		fclose(callStatsFile);
+	}
+
 	SDL_Quit();
 
 	return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -301,7 +301,8 @@ bitsy.loop(function(dt) {
 
 		bootLoad(bitsy.getGameData(), bitsy.getFontData());
 
-		// start playing the boot tune
+		// start playing the boot tune (stepped by the boot animation instead of the system's sequencer)
+		soundPlayer.setNativeSequencerEnabled(false);
 		soundPlayer.playTune(tune["1"]);
 
 		isLoaded = true;
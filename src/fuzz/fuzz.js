@@ -0,0 +1,22 @@
+// fuzz target for the game data loader (see the FUZZING section of main.c): the fuzz input is the
+// game data, which goes through everything a game's data goes through when it's loaded and played
+function __bitsybox_fuzz_world__() {
+	var gameData = bitsy.getGameData();
+	var world = parseWorld(gameData);
+
+	// normally fonts are only parsed, and scripts only compiled, once the game uses them
+	for (var fontFilename in world.fonts) {
+		fontManager.Create(world.fonts[fontFilename]);
+	}
+
+	for (var id in world.dialog) {
+		scriptInterpreter.Compile("fuzz_dialog_" + id, world.dialog[id].src);
+	}
+
+	for (var id in world.end) {
+		scriptInterpreter.Compile("fuzz_end_" + id, world.end[id].src);
+	}
+
+	// then load it the way a game is loaded (skipping the title), which sets up its first room
+	load_game(gameData, bitsy.getFontData(), false);
+}
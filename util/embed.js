@@ -11,6 +11,110 @@ if (typeof(arg) === "undefined") {
 	write = function(path, str) { fs.writeFileSync(path, str); };
 }
 
+// converts .bitsyfont text into a prebaked glyph table (see the glyph table format in font.js)
+function createGlyphTable(fontSrc) {
+	var name = "unknown";
+	var width = 6;
+	var height = 8;
+	var chars = {};
+
+	var curChar = null;
+	var isReadingCharProperties = false;
+	var curCharLineCount = 0;
+
+	var lines = fontSrc.split(/\r?\n/);
+	for (var i = 0; i < lines.length; i++) {
+		var line = lines[i];
+		var args = line.split(" ");
+
+		if (line[0] === "#") {
+			// skip comment lines
+		}
+		else if (curChar === null) {
+			if (args[0] === "FONT") {
+				name = args[1];
+			}
+			else if (args[0] === "SIZE") {
+				width = parseInt(args[1]);
+				height = parseInt(args[2]);
+			}
+			else if (args[0] === "CHAR") {
+				curChar = { width: width, height: height, offsetX: 0, offsetY: 0, spacing: width, data: [] };
+				chars[parseInt(args[1])] = curChar;
+				isReadingCharProperties = true;
+				curCharLineCount = 0;
+			}
+		}
+		else {
+			if (isReadingCharProperties) {
+				if (args[0] === "CHAR_SIZE") {
+					curChar.width = parseInt(args[1]);
+					curChar.height = parseInt(args[2]);
+					curChar.spacing = parseInt(args[1]);
+				}
+				else if (args[0] === "CHAR_OFFSET") {
+					curChar.offsetX = parseInt(args[1]);
+					curChar.offsetY = parseInt(args[2]);
+				}
+				else if (args[0] === "CHAR_SPACING") {
+					curChar.spacing = parseInt(args[1]);
+				}
+				else {
+					isReadingCharProperties = false;
+				}
+			}
+
+			if (!isReadingCharProperties) {
+				for (var x = 0; x < curChar.width; x++) {
+					curChar.data.push(line[x] === "1" ? 1 : 0);
+				}
+
+				curCharLineCount++;
+				if (curCharLineCount >= curChar.height) {
+					curChar = null;
+				}
+			}
+		}
+	}
+
+	var codepoints = [];
+	for (var code in chars) {
+		codepoints.push(parseInt(code));
+	}
+	codepoints.sort(function(a, b) { return a - b; });
+
+	function pushUint32(bytes, value) {
+		bytes.push(value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >>> 24) & 0xff);
+	}
+
+	var table = [66, 70, 78, 84, 1, width, height, name.length]; // "BFNT", version 1
+	for (var i = 0; i < name.length; i++) {
+		table.push(name.charCodeAt(i) & 0xff);
+	}
+	pushUint32(table, codepoints.length);
+
+	var bitmaps = [];
+	for (var i = 0; i < codepoints.length; i++) {
+		var c = chars[codepoints[i]];
+
+		pushUint32(table, codepoints[i]);
+		pushUint32(table, bitmaps.length);
+		table.push(c.width, c.height, c.offsetX & 0xff, c.offsetY & 0xff, c.spacing, 0, 0, 0);
+
+		var bitmapStart = bitmaps.length;
+		for (var j = 0; j < Math.ceil((c.width * c.height) / 8); j++) {
+			bitmaps.push(0);
+		}
+		for (var j = 0; j < c.data.length; j++) {
+			if (c.data[j] === 1) {
+				bitmaps[bitmapStart + (j >> 3)] |= (1 << (7 - (j & 7)));
+			}
+		}
+	}
+
+	return table.concat(bitmaps);
+}
+
 var srcPath = arg[0];
 var destPath = arg[1];
 
@@ -43,6 +147,22 @@ for (var i = 0; i < files.length; i++) {
 			lineStr = lineStr.replace(/"/g, '\\"');
 			embedHeaderStr += "\t\"" + lineStr + "\\n\"" + (j < fileLines.length - 1 ? "\n" : ";\n\n");
 		}
+
+		if (fileExt === "bitsyfont") {
+			// fonts are also embedded as prebaked glyph tables so they don't need to be parsed at runtime
+			var glyphTable = createGlyphTable(fileSrc);
+			var glyphTableName = fileName.replace(".", "_") + "_glyphs";
+
+			embedHeaderStr += "unsigned int " + glyphTableName + "_size = " + glyphTable.length + ";\n";
+			embedHeaderStr += "unsigned char " + glyphTableName + "[] = {\n";
+
+			for (var j = 0; j < glyphTable.length; j += 16) {
+				var rowBytes = glyphTable.slice(j, j + 16).map(function(b) { return "0x" + (b < 16 ? "0" : "") + b.toString(16); });
+				embedHeaderStr += "\t" + rowBytes.join(", ") + (j + 16 < glyphTable.length ? ",\n" : "\n");
+			}
+
+			embedHeaderStr += "};\n\n";
+		}
 	}
 }
 